@@ -0,0 +1,110 @@
+/* Benchmark of the hot paths of result and outcome, counting their allocations
+Replaces the global operator new with one counting allocations per thread, as
+test/tests/allocations.cpp does, then times each path for a few value types. Prints
+CSV of path and value type followed by nanoseconds and allocations per operation.
+The paths which never allocate ought to show zero, and failure() synthesis and print()
+show what they cost.
+*/
+#include "timing.h"
+#include "../include/outcome/iostream_support.hpp"
+#include "../include/outcome/outcome.hpp"
+#include "../include/outcome/try.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+#include <string>
+#include <vector>
+
+#define ITERATIONS 100000
+
+static thread_local size_t allocations;  // NOLINT
+
+// GCC pairs the free() below with the replaced operator new, and warns they mismatch
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void *operator new(size_t bytes)
+{
+  ++allocations;
+  void *ret = malloc(bytes != 0 ? bytes : 1);  // NOLINT
+  if(ret == nullptr)
+  {
+#ifdef __cpp_exceptions
+    throw std::bad_alloc();
+#else
+    abort();
+#endif
+  }
+  return ret;
+}
+void operator delete(void *p) noexcept
+{
+  free(p);  // NOLINT
+}
+void operator delete(void *p, size_t /*unused*/) noexcept
+{
+  free(p);  // NOLINT
+}
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+template <class T> static outcome::result<T> propagate(outcome::result<T> r)
+{
+  OUTCOME_TRY(v, std::move(r));
+  return std::move(v);
+}
+
+static volatile int sink;
+
+// Prints the nanoseconds and allocations per call of op
+template <class F> static void run(const char *path, const char *type, F &&op)
+{
+  size_t before = allocations;
+  usCount start = GetUsCount();
+  for(int n = 0; n < ITERATIONS; n++)
+  {
+    sink += op();
+  }
+  usCount end = GetUsCount();
+  printf("%s,%s,%f,%f\n", path, type, (double) (end - start) / 1000.0 / ITERATIONS, (double) (allocations - before) / ITERATIONS);
+}
+
+template <class T> static void paths(const char *type, const T &value)
+{
+  const std::error_code ec = make_error_code(std::errc::invalid_argument);
+  const outcome::result<T> valued(value), valued2(value), errored(ec);
+  run("construct", type, [&] { return (int) outcome::result<T>(ec).has_error(); });
+  run("move", type, [&] {
+    outcome::result<T> a(ec);
+    outcome::result<T> b(std::move(a));
+    return (int) b.has_error();
+  });
+  run("convert", type, [&] { return (int) outcome::outcome<T>(outcome::result<T>(ec)).has_error(); });
+  run("try", type, [&] { return (int) propagate(outcome::result<T>(ec)).has_error(); });
+  run("as_failure", type, [&] { return (int) outcome::result<T>(errored.as_failure()).has_error(); });
+  run("compare", type, [&] { return (int) (valued == valued2) + (int) (errored == outcome::failure(ec)); });
+  run("swap", type, [&] {
+    outcome::result<T> a(ec), b(ec);
+    a.swap(b);
+    return (int) a.has_error();
+  });
+#ifdef __cpp_exceptions
+  run("failure", type, [&] { return (int) (outcome::outcome<T>(ec).failure() != nullptr); });
+#endif
+}
+
+int main(void)
+{
+  printf("path,type,ns,allocations\n");
+  paths<int>("int", 5);
+  paths<std::string>("std::string", "a string long enough to defeat the small string optimisation");
+  paths<std::vector<int>>("std::vector<int>", {1, 2, 3, 4, 5});
+  // print() needs the value type to be printable
+  const outcome::result<int> errored(make_error_code(std::errc::invalid_argument));
+  run("print", "int", [&] { return (int) outcome::print(errored).size(); });
+  return 0;
+}
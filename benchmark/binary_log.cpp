@@ -0,0 +1,86 @@
+/* Benchmark of reading a file of results, parsing text with iostreams and walking a mapped binary log
+
+  c++ -std=c++14 -O2 binary_log.cpp -o binary_log
+
+Writes a million results both ways into the current directory, then prints nanoseconds per
+result to read each file back. The binary log is read decoding every record, and again only
+looking at the status of every record.
+*/
+#include "timing.h"
+#include "../include/outcome/binary_log.hpp"
+#include "../include/outcome/iostream_support.hpp"
+#include <fstream>
+#include <stdio.h>
+
+#define ITEMS 1000000
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+// iostreams cannot read back error codes, so both ways use an integer error
+using result = outcome::result<int, long>;
+
+int main(void)
+{
+  {
+    std::ofstream text("binary_log_bench.txt");
+    std::vector<unsigned char> buffer(ITEMS * 32);
+    size_t offset = 0;
+    for(int n = 0; n < ITEMS; n++)
+    {
+      result r(outcome::success(n));
+      if((n & 7) == 7)
+      {
+        r = outcome::failure(22L);
+      }
+      text << r << "\n";
+      offset += outcome::binary_log_encode(buffer.data() + offset, buffer.size() - offset, r).value();
+    }
+    FILE *f = fopen("binary_log_bench.bin", "wb");
+    fwrite(buffer.data(), 1, offset, f);
+    fclose(f);
+  }
+
+  long long total = 0;
+  result r(outcome::success(0));
+  usCount start = GetUsCount();
+  {
+    std::ifstream text("binary_log_bench.txt");
+    for(int n = 0; n < ITEMS; n++)
+    {
+      text >> r;
+      total += r.has_value() ? r.assume_value() : 0;
+    }
+  }
+  usCount end = GetUsCount();
+  printf("iostreams: %f ns per result\n", (double) (end - start) / 1000.0 / ITEMS);
+
+  start = GetUsCount();
+  {
+    auto mapping = outcome::binary_log_mapping::map("binary_log_bench.bin").value();
+    outcome::binary_log_reader reader(mapping);
+    for(outcome::binary_log_record record : reader)
+    {
+      record.decode(r).value();
+      total -= r.has_value() ? r.assume_value() : 0;
+    }
+  }
+  end = GetUsCount();
+  printf("binary log decoding: %f ns per result\n", (double) (end - start) / 1000.0 / ITEMS);
+
+  size_t failed = 0;
+  start = GetUsCount();
+  {
+    auto mapping = outcome::binary_log_mapping::map("binary_log_bench.bin").value();
+    outcome::binary_log_reader reader(mapping);
+    for(outcome::binary_log_record record : reader)
+    {
+      failed += record.has_error();
+    }
+  }
+  end = GetUsCount();
+  printf("binary log status only: %f ns per result\n", (double) (end - start) / 1000.0 / ITEMS);
+
+  remove("binary_log_bench.txt");
+  remove("binary_log_bench.bin");
+  return (total == 0 && failed == ITEMS / 8) ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+/* Benchmark of serialising many results, as text through iostreams and with binary_encode()
+
+  c++ -std=c++14 -O2 binary_serialisation.cpp -o binary_serialisation
+
+Prints nanoseconds per result to serialise and deserialise a batch of results,
+one in eight of which is failed, using each way.
+*/
+#include "timing.h"
+#include "../include/outcome/binary_support.hpp"
+#include "../include/outcome/iostream_support.hpp"
+#include <stdio.h>
+#include <vector>
+
+#define ITEMS 1000000
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+int main(void)
+{
+  // iostreams cannot read back error codes, so both ways use an integer error
+  using result = outcome::result<int, long>;
+  std::vector<result> in, out(ITEMS, result(outcome::success(0)));
+  in.reserve(ITEMS);
+  for(int n = 0; n < ITEMS; n++)
+  {
+    if((n & 7) == 7)
+    {
+      in.emplace_back(outcome::failure(22L));
+    }
+    else
+    {
+      in.emplace_back(outcome::success(n));
+    }
+  }
+
+  usCount start = GetUsCount();
+  std::stringstream ss;
+  for(const auto &i : in)
+  {
+    ss << i << "\n";
+  }
+  for(auto &i : out)
+  {
+    ss >> i;
+  }
+  usCount end = GetUsCount();
+  printf("iostreams: %f ns per result\n", (double) (end - start) / 1000.0 / ITEMS);
+
+  std::vector<unsigned char> buffer(ITEMS * 16);
+  start = GetUsCount();
+  size_t offset = 0;
+  for(const auto &i : in)
+  {
+    offset += outcome::binary_encode(buffer.data() + offset, buffer.size() - offset, i).value();
+  }
+  const size_t length = offset;
+  offset = 0;
+  for(auto &i : out)
+  {
+    offset += outcome::binary_decode(buffer.data() + offset, length - offset, i).value();
+  }
+  end = GetUsCount();
+  printf("binary: %f ns per result\n", (double) (end - start) / 1000.0 / ITEMS);
+  return (out == in) ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+/* Error handling systems compared by the call chain benchmark
+
+For the fixed baseline, one of these is defined by CMakeLists.txt:
+
+  BENCHMARK_INTEGER_RETURNS     Returns int, failure is -1
+  BENCHMARK_EXCEPTION_THROW     Returns int, failure is thrown
+  BENCHMARK_RESULT_ERROR_VALUE  Returns result<int>, always a value
+  BENCHMARK_RESULT_ERROR_ERROR  Returns result<int>, always an error_code
+  BENCHMARK_RESULT_EXCPT_VALUE  Returns result<int, std::exception_ptr>, always a value
+  BENCHMARK_RESULT_EXCPT_ERROR  Returns result<int, std::exception_ptr>, always an exception_ptr
+
+For the matrix, one of these systems, where each function in the chain checks what
+the next returned and propagates any failure:
+
+  BENCHMARK_MATRIX_RESULT_ERROR_CODE     Returns result<T, std::error_code>
+  BENCHMARK_MATRIX_RESULT_ENUM           Returns result<T, benchmark_errc>
+  BENCHMARK_MATRIX_RESULT_STATUS_CODE    Returns experimental::status_result<T>
+  BENCHMARK_MATRIX_RESULT_EXCEPTION_PTR  Returns result<T, std::exception_ptr>
+  BENCHMARK_MATRIX_EXPECTED              Returns std::expected<T, std::error_code>
+  BENCHMARK_MATRIX_OPTIONAL_OUT_PARAM    Returns std::optional<T>, error_code out parameter
+  BENCHMARK_MATRIX_EXCEPTIONS            Returns T, failure is thrown
+
+and one of these value types T:
+
+  BENCHMARK_VALUE_INT     int
+  BENCHMARK_VALUE_POD64   A 64 byte trivially copyable struct
+  BENCHMARK_VALUE_STRING  A std::string too long for the small string optimisation
+  BENCHMARK_VALUE_VECTOR  A std::vector<int> of sixteen items
+
+The matrix fails at the rate given to the runner with --failure-rate.
+*/
+
+#ifndef BENCHMARK_CHAIN_HPP
+#define BENCHMARK_CHAIN_HPP
+
+#include <exception>
+
+// The function at depth n of the chain is functn, calling funct(n-1) down to funct0
+#define BENCHMARK_FUNCTION(n) BENCHMARK_FUNCTION_(n)
+#define BENCHMARK_FUNCTION_(n) funct##n
+
+#if defined(BENCHMARK_MATRIX_RESULT_ERROR_CODE) || defined(BENCHMARK_MATRIX_RESULT_ENUM) || defined(BENCHMARK_MATRIX_RESULT_STATUS_CODE) || defined(BENCHMARK_MATRIX_RESULT_EXCEPTION_PTR) || defined(BENCHMARK_MATRIX_EXPECTED) || defined(BENCHMARK_MATRIX_OPTIONAL_OUT_PARAM) || defined(BENCHMARK_MATRIX_EXCEPTIONS)
+#define BENCHMARK_MATRIX 1
+
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+// Whether the final function fails for par is benchmark_failures[par & BENCHMARK_FAILURES_MASK],
+// a table shuffled by the runner to hold the failure rate
+#define BENCHMARK_FAILURES_MASK 4095
+extern const unsigned char *benchmark_failures;
+
+#if defined(BENCHMARK_VALUE_INT)
+typedef int benchmark_value_type;
+inline benchmark_value_type benchmark_make_value(int par) { return par; }
+#elif defined(BENCHMARK_VALUE_POD64)
+struct benchmark_pod64
+{
+  int data[16];
+};
+typedef benchmark_pod64 benchmark_value_type;
+inline benchmark_value_type benchmark_make_value(int par)
+{
+  benchmark_pod64 ret = {{par}};
+  return ret;
+}
+#elif defined(BENCHMARK_VALUE_STRING)
+typedef std::string benchmark_value_type;
+inline benchmark_value_type benchmark_make_value(int par) { return std::string(48, (char) ('a' + (par & 15))); }
+#elif defined(BENCHMARK_VALUE_VECTOR)
+typedef std::vector<int> benchmark_value_type;
+inline benchmark_value_type benchmark_make_value(int par) { return std::vector<int>(16, par); }
+#else
+#error One of the BENCHMARK_VALUE_* value types must be defined
+#endif
+
+#define BENCHMARK_OUT_PARAM
+#define BENCHMARK_OUT_ARG
+
+#if defined(BENCHMARK_MATRIX_RESULT_ERROR_CODE) || defined(BENCHMARK_MATRIX_RESULT_ENUM) || defined(BENCHMARK_MATRIX_RESULT_EXCEPTION_PTR)
+#include "../include/outcome/result.hpp"
+#if defined(BENCHMARK_MATRIX_RESULT_ERROR_CODE)
+typedef OUTCOME_V2_NAMESPACE::result<benchmark_value_type, std::error_code> benchmark_return_type;
+inline benchmark_return_type benchmark_failure() { return std::error_code(5, std::generic_category()); }
+#elif defined(BENCHMARK_MATRIX_RESULT_ENUM)
+enum class benchmark_errc
+{
+  failed = 1
+};
+typedef OUTCOME_V2_NAMESPACE::result<benchmark_value_type, benchmark_errc> benchmark_return_type;
+inline benchmark_return_type benchmark_failure() { return OUTCOME_V2_NAMESPACE::failure(benchmark_errc::failed); }
+#else
+typedef OUTCOME_V2_NAMESPACE::result<benchmark_value_type, std::exception_ptr> benchmark_return_type;
+inline benchmark_return_type benchmark_failure() { return std::make_exception_ptr(std::exception()); }
+#endif
+#elif defined(BENCHMARK_MATRIX_RESULT_STATUS_CODE)
+#include "../include/outcome/experimental/status_result.hpp"
+typedef OUTCOME_V2_NAMESPACE::experimental::status_result<benchmark_value_type> benchmark_return_type;
+inline benchmark_return_type benchmark_failure() { return SYSTEM_ERROR2_NAMESPACE::errc::invalid_argument; }
+#elif defined(BENCHMARK_MATRIX_EXPECTED)
+#include <expected>
+typedef std::expected<benchmark_value_type, std::error_code> benchmark_return_type;
+inline benchmark_return_type benchmark_failure() { return std::unexpected(std::error_code(5, std::generic_category())); }
+#elif defined(BENCHMARK_MATRIX_OPTIONAL_OUT_PARAM)
+#include <optional>
+typedef std::optional<benchmark_value_type> benchmark_return_type;
+#undef BENCHMARK_OUT_PARAM
+#undef BENCHMARK_OUT_ARG
+#define BENCHMARK_OUT_PARAM , std::error_code &ec
+#define BENCHMARK_OUT_ARG , ec
+#else
+typedef benchmark_value_type benchmark_return_type;
+#endif
+
+// The body of funct0, the end of the chain
+inline benchmark_return_type benchmark_final(int par BENCHMARK_OUT_PARAM)
+{
+  if(benchmark_failures[par & BENCHMARK_FAILURES_MASK])
+  {
+#if defined(BENCHMARK_MATRIX_OPTIONAL_OUT_PARAM)
+    ec = std::error_code(5, std::generic_category());
+    return std::nullopt;
+#elif defined(BENCHMARK_MATRIX_EXCEPTIONS)
+    throw std::exception();
+#else
+    return benchmark_failure();
+#endif
+  }
+  return benchmark_make_value(par);
+}
+
+// Propagates any failure of the next function down the chain, else returns its value
+inline benchmark_return_type benchmark_propagate(benchmark_return_type &&r)
+{
+#if defined(BENCHMARK_MATRIX_EXCEPTIONS)
+  return std::move(r);
+#elif defined(BENCHMARK_MATRIX_OPTIONAL_OUT_PARAM)
+  if(!r)
+  {
+    return std::nullopt;
+  }
+  return std::move(*r);
+#elif defined(BENCHMARK_MATRIX_EXPECTED)
+  if(!r)
+  {
+    return std::unexpected(std::move(r).error());
+  }
+  return std::move(*r);
+#else
+  if(!r)
+  {
+    return std::move(r).assume_error();
+  }
+  return std::move(r).assume_value();
+#endif
+}
+
+// Whether a call of the chain failed, for the runner
+#if defined(BENCHMARK_MATRIX_EXCEPTIONS)
+inline bool benchmark_failed(const benchmark_return_type & /*unused*/) { return false; }
+#else
+inline bool benchmark_failed(const benchmark_return_type &r) { return !r; }
+#endif
+
+#else  // the fixed baseline
+
+#define BENCHMARK_OUT_PARAM
+#define BENCHMARK_OUT_ARG
+
+#if defined(BENCHMARK_INTEGER_RETURNS) || defined(BENCHMARK_EXCEPTION_THROW)
+typedef int benchmark_return_type;
+#else
+#include "../include/outcome/result.hpp"
+#if defined(BENCHMARK_RESULT_ERROR_VALUE) || defined(BENCHMARK_RESULT_ERROR_ERROR)
+typedef OUTCOME_V2_NAMESPACE::result<int> benchmark_return_type;
+#else
+typedef OUTCOME_V2_NAMESPACE::result<int, std::exception_ptr> benchmark_return_type;
+#endif
+#endif
+
+// The body of funct0, the end of the chain
+inline benchmark_return_type benchmark_final(int par)
+{
+#if defined(BENCHMARK_INTEGER_RETURNS)
+  return par ? -1 : 0;
+#elif defined(BENCHMARK_EXCEPTION_THROW)
+  (void) par;
+  throw std::exception();
+#elif defined(BENCHMARK_RESULT_ERROR_VALUE) || defined(BENCHMARK_RESULT_EXCPT_VALUE)
+  return par;
+#elif defined(BENCHMARK_RESULT_ERROR_ERROR)
+  (void) par;
+  return std::error_code(5, std::generic_category());
+#elif defined(BENCHMARK_RESULT_EXCPT_ERROR)
+  (void) par;
+  return std::make_exception_ptr(std::exception());
+#else
+#error One of the BENCHMARK_* error handling systems must be defined
+#endif
+}
+
+// Functions in the chain return what the next returned
+inline benchmark_return_type benchmark_propagate(benchmark_return_type r) { return r; }
+
+// Whether a call of the chain failed, for the runner
+inline bool benchmark_failed(const benchmark_return_type &r) { return !r; }
+
+#endif
+
+#endif
@@ -0,0 +1,100 @@
+/* Instantiations measured by the compile time benchmark
+
+compile_time.py generates a translation unit which explicitly instantiates
+compile_time_result<N>() and compile_time_outcome<N>() for N distinct value types,
+each using every constructor and observer, then measures how long it takes to compile,
+the peak memory of the compiler, and the size of the object file.
+
+Defining OUTCOME_COMPILE_TIME_HEADER to a quoted path includes that edition of Outcome,
+e.g. a single header one, instead of include/outcome.hpp. module_compile_time.py
+uses this to compare the editions against importing the C++ module. debug_size.py
+links many translation units of these into one program to measure its debug info.
+*/
+
+#ifndef BENCHMARK_COMPILE_TIME_HPP
+#define BENCHMARK_COMPILE_TIME_HPP
+
+// Everything used from the standard library, which a C++ module importer does not get
+#include <exception>
+#include <system_error>
+#include <utility>
+
+#ifdef OUTCOME_COMPILE_TIME_HEADER
+#include OUTCOME_COMPILE_TIME_HEADER
+#else
+#include "../include/outcome.hpp"
+#endif
+
+// A distinct value type for each N
+template <int N> struct compile_time_value
+{
+  int v;
+  compile_time_value(int _v)  // NOLINT
+      : v(_v)
+  {
+  }
+  bool operator==(const compile_time_value &o) const noexcept { return v == o.v; }
+  bool operator!=(const compile_time_value &o) const noexcept { return v != o.v; }
+};
+
+template <int N> int compile_time_result(int x)
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using value_type = compile_time_value<N>;
+  using result_type = result<value_type, std::error_code>;
+  // Constructors
+  result_type a(value_type{x});
+  result_type b(std::error_code(x, std::generic_category()));
+  result_type c(std::errc::invalid_argument);
+  result_type d(in_place_type<value_type>, x);
+  result_type e(in_place_type<std::error_code>, x, std::generic_category());
+  result_type f(success(value_type{x}));
+  result_type g(failure(std::error_code(x, std::generic_category())));
+  result_type h(a);
+  result_type i(std::move(h));
+  result_type j{result<int, std::error_code>(x)};
+  // Assignment and swap
+  h = b;
+  i = std::move(c);
+  h.swap(i);
+  // Observers
+  int ret = a.has_value() + b.has_error() + c.has_failure() + static_cast<bool>(d);
+  ret += (a == d) + (b != e) + (f == success()) + (g != failure(std::error_code()));
+  ret += a.value().v + a.assume_value().v + j.value().v + std::move(f).value().v;
+  ret += b.error().value() + b.assume_error().value() + std::move(g).error().value();
+  return ret;
+}
+
+template <int N> int compile_time_outcome(int x)
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using value_type = compile_time_value<N>;
+  using outcome_type = outcome<value_type>;
+  // Constructors
+  outcome_type a(value_type{x});
+  outcome_type b(std::error_code(x, std::generic_category()));
+  outcome_type c(std::errc::invalid_argument);
+  outcome_type d(std::make_exception_ptr(x));
+  outcome_type e(in_place_type<value_type>, x);
+  outcome_type f(in_place_type<std::error_code>, x, std::generic_category());
+  outcome_type g(success(value_type{x}));
+  outcome_type h(failure(std::error_code(x, std::generic_category())));
+  outcome_type i(failure(std::error_code(x, std::generic_category()), std::make_exception_ptr(x)));
+  outcome_type j(a);
+  outcome_type k(std::move(j));
+  outcome_type l(result<value_type, std::error_code>(value_type{x}));
+  outcome_type m{outcome<int>(x)};
+  // Assignment and swap
+  j = b;
+  k = std::move(c);
+  j.swap(k);
+  // Observers
+  int ret = a.has_value() + b.has_error() + c.has_failure() + d.has_exception() + static_cast<bool>(e);
+  ret += (a == e) + (b != f) + (g == success()) + (h != failure(std::error_code()));
+  ret += a.value().v + a.assume_value().v + l.value().v + m.value().v + std::move(g).value().v;
+  ret += b.error().value() + b.assume_error().value() + std::move(h).error().value();
+  ret += static_cast<bool>(d.exception()) + static_cast<bool>(d.assume_exception()) + static_cast<bool>(i.failure());
+  return ret;
+}
+
+#endif
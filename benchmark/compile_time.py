@@ -0,0 +1,131 @@
+#!/usr/bin/python3
+# Compile time benchmark, run by the outcome-benchmark-compile-time target of CMakeLists.txt
+#
+# For each count N, generates a translation unit explicitly instantiating
+# compile_time_result<n>() and compile_time_outcome<n>() of compile_time.hpp for n from
+# 0 to N - 1, then compiles it with each compiler at each optimisation level, printing
+# the minimum and median wall and CPU time of the compile, the peak memory of the compiler
+# and the size of the object file. --csv and --json write them to FILE. CPU time and peak
+# memory need a POSIX host.
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import time
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Measure the cost of compiling many distinct results and outcomes')
+    parser.add_argument('--compiler', action='append', required=True, metavar='NAME=PATH',
+                        help='a compiler to measure, e.g. gcc=/usr/bin/g++')
+    parser.add_argument('--opt', action='append', metavar='LEVEL', help='an optimisation level, default O0 and O2')
+    parser.add_argument('--count', action='append', type=int, metavar='N',
+                        help='a number of distinct instantiations, default 0, 10 and 50')
+    parser.add_argument('--repetitions', type=int, default=3, help='the compiles of each, default 3')
+    parser.add_argument('--flags', default='', help='extra compiler flags, e.g. include directories')
+    parser.add_argument('--work', default='.', help='the directory for generated sources and objects')
+    parser.add_argument('--csv', metavar='FILE', help='write the results as CSV to FILE')
+    parser.add_argument('--json', metavar='FILE', help='write the results as JSON to FILE')
+    args = parser.parse_args()
+    if args.opt is None:
+        args.opt = ['O0', 'O2']
+    if args.count is None:
+        args.count = [0, 10, 50]
+    if args.repetitions < 1:
+        parser.error('--repetitions must be at least 1')
+    return args
+
+
+def generate(work : str, count : int) -> str:
+    header = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'compile_time.hpp')
+    source = os.path.join(work, 'compile_time_%d.cpp' % count)
+    with open(source, 'wt') as oh:
+        oh.write('// Generated by compile_time.py\n')
+        oh.write('#include "%s"\n' % header.replace('\\', '/'))
+        for n in range(count):
+            oh.write('template int compile_time_result<%d>(int);\n' % n)
+            oh.write('template int compile_time_outcome<%d>(int);\n' % n)
+    return source
+
+
+# Returns the wall seconds, CPU seconds and peak memory in MiB of command, or None for
+# the latter two if the host cannot say. The CPU time and peak memory of the compiler
+# driver include those of the compiler proper it waits for.
+def run(command : list):
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    output = process.stdout.read()
+    if hasattr(os, 'wait4'):
+        _, status, usage = os.wait4(process.pid, 0)
+        process.returncode = os.waitstatus_to_exitcode(status) if hasattr(os, 'waitstatus_to_exitcode') else status
+        # ru_maxrss is in kilobytes on Linux, bytes on macOS
+        cpu = usage.ru_utime + usage.ru_stime
+        memory = usage.ru_maxrss / (1024 * 1024 if sys.platform == 'darwin' else 1024)
+    else:
+        process.wait()
+        cpu, memory = None, None
+    seconds = time.perf_counter() - start
+    if process.returncode != 0:
+        raise RuntimeError('%s failed:\n%s' % (' '.join(command), output.decode('utf-8', 'replace')))
+    return seconds, cpu, memory
+
+
+def median(values : list) -> float:
+    values = sorted(values)
+    count = len(values)
+    return values[count // 2] if count % 2 else (values[count // 2 - 1] + values[count // 2]) / 2
+
+
+def main() -> int:
+    args = parse_args()
+    os.makedirs(args.work, exist_ok=True)
+    results = []
+    for count in args.count:
+        source = generate(args.work, count)
+        for spec in args.compiler:
+            name, _, compiler = spec.partition('=')
+            version = subprocess.check_output([compiler, '-dumpversion'], universal_newlines=True).strip()
+            for opt in args.opt:
+                obj = os.path.join(args.work, 'compile_time_%d.%s.%s.o' % (count, name, opt))
+                command = [compiler, '-std=c++14', '-' + opt] + args.flags.split() + ['-c', source, '-o', obj]
+                times, cpus, memories = [], [], []
+                for _ in range(args.repetitions):
+                    seconds, cpu, memory = run(command)
+                    times.append(seconds)
+                    cpus.append(cpu)
+                    memories.append(memory)
+                r = {
+                    'compiler': name,
+                    'version': version,
+                    'optimisation': opt,
+                    'instantiations': count,
+                    'repetitions': args.repetitions,
+                    'seconds min': min(times),
+                    'seconds median': median(times),
+                    'cpu seconds min': None if None in cpus else min(cpus),
+                    'cpu seconds median': None if None in cpus else median(cpus),
+                    'peak memory MiB': None if None in memories else max(memories),
+                    'object bytes': os.path.getsize(obj),
+                }
+                results.append(r)
+                print('%s %s -%s, %d instantiations, %d compiles: seconds min %f median %f, cpu seconds %s, peak memory %s MiB, object %d bytes'
+                      % (name, version, opt, count, args.repetitions, r['seconds min'], r['seconds median'],
+                         'unavailable' if r['cpu seconds min'] is None else 'min %f median %f' % (r['cpu seconds min'], r['cpu seconds median']),
+                         'unavailable' if r['peak memory MiB'] is None else '%.1f' % r['peak memory MiB'], r['object bytes']))
+    if args.csv is not None:
+        with open(args.csv, 'wt') as oh:
+            columns = list(results[0].keys())
+            oh.write(','.join('"%s"' % c for c in columns) + '\n')
+            for r in results:
+                oh.write(','.join('"%s"' % r[c] if isinstance(r[c], str) else ('' if r[c] is None else str(r[c])) for c in columns) + '\n')
+    if args.json is not None:
+        with open(args.json, 'wt') as oh:
+            json.dump(results, oh, indent=2)
+            oh.write('\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,55 @@
+/* Benchmark of observer throughput in debug builds
+Build twice at -O0, once with -DOUTCOME_ENABLE_DEBUG_INLINING, and compare:
+
+  c++ -std=c++14 -O0 debug_inlining.cpp -o plain
+  c++ -std=c++14 -O0 -DOUTCOME_ENABLE_DEBUG_INLINING debug_inlining.cpp -o flattened
+
+which the outcome-benchmark-debug-inlining and outcome-benchmark-debug-inlining-flattened
+targets of CMakeLists.txt do.
+
+Prints nanoseconds per iteration of a loop observing a result and an outcome.
+*/
+#include "timing.h"
+#include "../include/outcome/outcome.hpp"
+#include <stdio.h>
+
+#define ITERATIONS 10000000
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+extern volatile int counter;
+volatile int counter;
+
+int main(void)
+{
+  outcome::result<int> r(5);
+  outcome::outcome<int> o(6);
+  outcome::result<int> e(std::errc::invalid_argument);
+  usCount start = GetUsCount();
+  for(int n = 0; n < ITERATIONS; n++)
+  {
+    int acc = 0;
+    if(r.has_value())
+    {
+      acc += r.value() + r.assume_value();
+    }
+    if(o)
+    {
+      acc += o.value();
+    }
+    if(e.has_error())
+    {
+      acc += e.error().value() + e.assume_error().value();
+    }
+    counter += acc;
+  }
+  usCount end = GetUsCount();
+  printf("%s: %f ns per iteration\n",
+#ifdef OUTCOME_ENABLE_DEBUG_INLINING
+         "flattened",
+#else
+         "plain",
+#endif
+         (double) (end - start) / 1000.0 / ITERATIONS);
+  return 0;
+}
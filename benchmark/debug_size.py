@@ -0,0 +1,164 @@
+#!/usr/bin/python3
+# Debug info size benchmark, run by the outcome-benchmark-debug-size target of CMakeLists.txt
+#
+# For each count N of translation units, generates a program of N translation units each
+# explicitly instantiating compile_time_result<n>() and compile_time_outcome<n>() of
+# compile_time.hpp for its own --per-unit values of n, and a main() calling them all. The
+# program is compiled with -g by each compiler at each optimisation level, then linked
+# repeatedly, printing the minimum and median wall time of the link, and the sizes of the
+# .debug_info, .debug_str and .strtab sections and of the executable. These are mostly the
+# mangled names and type names of the instantiated results and outcomes. --csv and --json
+# write them to FILE. Section sizes need an ELF host, elsewhere they are reported as
+# unavailable.
+
+import argparse
+import json
+import os
+import struct
+import subprocess
+import sys
+
+from compile_time import median, run
+
+header = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'compile_time.hpp')
+sections = ('.debug_info', '.debug_str', '.strtab')
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Measure the debug info, symbol table and link time of many distinct results and outcomes')
+    parser.add_argument('--compiler', action='append', required=True, metavar='NAME=PATH',
+                        help='a compiler to measure, e.g. gcc=/usr/bin/g++')
+    parser.add_argument('--opt', action='append', metavar='LEVEL', help='an optimisation level, default O0 and O2')
+    parser.add_argument('--count', action='append', type=int, metavar='N',
+                        help='a number of translation units, default 10 and 50')
+    parser.add_argument('--per-unit', type=int, default=4, help='the distinct value types of each translation unit, default 4')
+    parser.add_argument('--repetitions', type=int, default=3, help='the links of each, default 3')
+    parser.add_argument('--flags', default='', help='extra compiler flags, e.g. include directories')
+    parser.add_argument('--work', default='.', help='the directory for generated sources, objects and executables')
+    parser.add_argument('--csv', metavar='FILE', help='write the results as CSV to FILE')
+    parser.add_argument('--json', metavar='FILE', help='write the results as JSON to FILE')
+    args = parser.parse_args()
+    if args.opt is None:
+        args.opt = ['O0', 'O2']
+    if args.count is None:
+        args.count = [10, 50]
+    if args.repetitions < 1:
+        parser.error('--repetitions must be at least 1')
+    if args.per_unit < 1:
+        parser.error('--per-unit must be at least 1')
+    return args
+
+
+# Returns the sources of a program of count translation units
+def generate(work : str, count : int, per_unit : int) -> list:
+    directory = os.path.join(work, 'debug_size_%d' % count)
+    os.makedirs(directory, exist_ok=True)
+    sources = []
+    for unit in range(count):
+        source = os.path.join(directory, 'unit_%d.cpp' % unit)
+        with open(source, 'wt') as oh:
+            oh.write('// Generated by debug_size.py\n')
+            oh.write('#include "%s"\n' % header.replace('\\', '/'))
+            for n in range(unit * per_unit, (unit + 1) * per_unit):
+                oh.write('template int compile_time_result<%d>(int);\n' % n)
+                oh.write('template int compile_time_outcome<%d>(int);\n' % n)
+        sources.append(source)
+    source = os.path.join(directory, 'main.cpp')
+    with open(source, 'wt') as oh:
+        oh.write('// Generated by debug_size.py\n')
+        oh.write('template <int N> int compile_time_result(int);\n')
+        oh.write('template <int N> int compile_time_outcome(int);\n')
+        oh.write('int main(int argc, char **)\n{\n  int ret = 0;\n')
+        for n in range(count * per_unit):
+            oh.write('  ret += compile_time_result<%d>(argc) + compile_time_outcome<%d>(argc);\n' % (n, n))
+        oh.write('  return ret == 0;\n}\n')
+    sources.append(source)
+    return sources
+
+
+# Returns the sizes of the named sections of an ELF file, or None if it is not one
+def section_sizes(path : str):
+    with open(path, 'rb') as ih:
+        data = ih.read()
+    if data[:4] != b'\x7fELF':
+        return None
+    wide, endian = data[4] == 2, '<' if data[5] == 1 else '>'
+    if wide:
+        shoff, = struct.unpack_from(endian + 'Q', data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + 'HHH', data, 0x3a)
+    else:
+        shoff, = struct.unpack_from(endian + 'I', data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + 'HHH', data, 0x2e)
+
+    def header(index : int):
+        offset = shoff + index * shentsize
+        if wide:
+            name, = struct.unpack_from(endian + 'I', data, offset)
+            file_offset, size = struct.unpack_from(endian + 'QQ', data, offset + 0x18)
+        else:
+            name, = struct.unpack_from(endian + 'I', data, offset)
+            file_offset, size = struct.unpack_from(endian + 'II', data, offset + 0x10)
+        return name, file_offset, size
+
+    _, names, _ = header(shstrndx)
+    sizes = dict((s, 0) for s in sections)
+    for index in range(shnum):
+        name, _, size = header(index)
+        name = data[names + name:data.index(b'\0', names + name)].decode('ascii', 'replace')
+        if name in sizes:
+            sizes[name] = size
+    return sizes
+
+
+def main() -> int:
+    args = parse_args()
+    os.makedirs(args.work, exist_ok=True)
+    flags = args.flags.split()
+    results = []
+    for count in args.count:
+        sources = generate(args.work, count, args.per_unit)
+        for spec in args.compiler:
+            name, _, compiler = spec.partition('=')
+            version = subprocess.check_output([compiler, '-dumpversion'], universal_newlines=True).strip()
+            for opt in args.opt:
+                objects = []
+                for source in sources:
+                    obj = '%s.%s.%s.o' % (os.path.splitext(source)[0], name, opt)
+                    run([compiler, '-std=c++14', '-g', '-' + opt] + flags + ['-c', source, '-o', obj])
+                    objects.append(obj)
+                exe = os.path.join(args.work, 'debug_size_%d.%s.%s.exe' % (count, name, opt))
+                times = [run([compiler, '-g', '-' + opt] + flags + objects + ['-o', exe])[0] for _ in range(args.repetitions)]
+                sizes = section_sizes(exe)
+                r = {
+                    'compiler': name,
+                    'version': version,
+                    'optimisation': opt,
+                    'translation units': count,
+                    'instantiations': count * args.per_unit,
+                    'repetitions': args.repetitions,
+                    'link seconds min': min(times),
+                    'link seconds median': median(times),
+                }
+                for s in sections:
+                    r[s + ' bytes'] = None if sizes is None else sizes[s]
+                r['executable bytes'] = os.path.getsize(exe)
+                results.append(r)
+                print('%s %s -%s, %d translation units, %d instantiations, %d links: seconds min %f median %f, %s, executable %d bytes'
+                      % (name, version, opt, count, r['instantiations'], args.repetitions, r['link seconds min'], r['link seconds median'],
+                         ', '.join('%s %s' % (s, 'unavailable' if r[s + ' bytes'] is None else '%d bytes' % r[s + ' bytes']) for s in sections),
+                         r['executable bytes']))
+    if args.csv is not None:
+        with open(args.csv, 'wt') as oh:
+            columns = list(results[0].keys())
+            oh.write(','.join('"%s"' % c for c in columns) + '\n')
+            for r in results:
+                oh.write(','.join('"%s"' % r[c] if isinstance(r[c], str) else ('' if r[c] is None else str(r[c])) for c in columns) + '\n')
+    if args.json is not None:
+        with open(args.json, 'wt') as oh:
+            json.dump(results, oh, indent=2)
+            oh.write('\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,40 @@
+/* Benchmark of formatting results for logging, with print() and with to_chars()
+
+  c++ -std=c++17 -O2 format_support.cpp -o format_support
+
+Prints nanoseconds per result to format a valued and an errored result each way.
+*/
+#include "timing.h"
+#include "../include/outcome/format_support.hpp"
+#include "../include/outcome/iostream_support.hpp"
+#include <stdio.h>
+
+#define ITERATIONS 1000000
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+extern volatile size_t counter;
+volatile size_t counter;
+
+int main(void)
+{
+  outcome::result<int> results[2] = {outcome::result<int>(78), outcome::result<int>(std::errc::invalid_argument)};
+
+  usCount start = GetUsCount();
+  for(int n = 0; n < ITERATIONS; n++)
+  {
+    counter += outcome::print(results[n & 1]).size();
+  }
+  usCount end = GetUsCount();
+  printf("print(): %f ns per result\n", (double) (end - start) / 1000.0 / ITERATIONS);
+
+  char buffer[64];
+  start = GetUsCount();
+  for(int n = 0; n < ITERATIONS; n++)
+  {
+    counter += outcome::to_chars(buffer, buffer + sizeof(buffer), results[n & 1]).ptr - buffer;
+  }
+  end = GetUsCount();
+  printf("to_chars(): %f ns per result\n", (double) (end - start) / 1000.0 / ITERATIONS);
+  return 0;
+}
@@ -0,0 +1,44 @@
+/* Benchmark of parsing results from text, with operator>> and with from_chars()
+
+  c++ -std=c++17 -O2 from_chars.cpp -o from_chars
+
+Prints nanoseconds per result to parse alternately valued and errored results each way.
+*/
+#include "timing.h"
+#include "../include/outcome/iostream_support.hpp"
+#include <stdio.h>
+
+#define ITERATIONS 1000000
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+extern volatile size_t counter;
+volatile size_t counter;
+
+int main(void)
+{
+  using result_type = outcome::result<int, long>;
+  std::string text;
+  for(int n = 0; n < ITERATIONS; n++)
+  {
+    text.append((n & 1) ? "2 78\n" : "1 5\n");
+  }
+
+  result_type v(outcome::success(0));
+  std::istringstream ss(text);
+  usCount start = GetUsCount();
+  for(int n = 0; n < ITERATIONS; n++)
+  {
+    ss >> v;
+    counter += v.has_value();
+  }
+  usCount end = GetUsCount();
+  printf("operator>>: %f ns per result\n", (double) (end - start) / 1000.0 / ITERATIONS);
+
+  start = GetUsCount();
+  auto r = outcome::from_chars_lines(text.data(), text.data() + text.size(), v, [](const result_type &i) { counter += i.has_value(); });
+  end = GetUsCount();
+  counter += r.value();
+  printf("from_chars_lines(): %f ns per result\n", (double) (end - start) / 1000.0 / ITERATIONS);
+  return 0;
+}
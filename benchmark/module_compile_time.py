@@ -0,0 +1,150 @@
+#!/usr/bin/python3
+# Module compile time benchmark, run by the outcome-benchmark-module-compile-time target of
+# CMakeLists.txt
+#
+# Compares the cost of compiling the translation units of compile_time.py when Outcome is
+# included as include/outcome.hpp, included as single-header/outcome.hpp, and imported as
+# the C++ module outcome_v2_0 of include/outcome.ixx. The compile of the module interface
+# itself is reported as its own edition, as a build pays it once however many translation
+# units import it. Columns are those of compile_time.py plus the edition. Editions which
+# fail to compile are reported and skipped, and make the exit code non-zero.
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+from compile_time import generate, median, run
+
+repo = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+interface = os.path.join(repo, 'include', 'outcome.ixx')
+single_header = os.path.join(repo, 'single-header', 'outcome.hpp')
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Compare the cost of including Outcome against importing it as a C++ module')
+    parser.add_argument('--compiler', action='append', required=True, metavar='NAME=PATH',
+                        help='a compiler to measure, e.g. gcc=/usr/bin/g++')
+    parser.add_argument('--opt', action='append', metavar='LEVEL', help='an optimisation level, default O0 and O2')
+    parser.add_argument('--count', action='append', type=int, metavar='N',
+                        help='a number of distinct instantiations, default 0, 10 and 50')
+    parser.add_argument('--repetitions', type=int, default=3, help='the compiles of each, default 3')
+    parser.add_argument('--flags', default='', help='extra compiler flags, e.g. include directories')
+    parser.add_argument('--work', default='.', help='the directory for generated sources, modules and objects')
+    parser.add_argument('--csv', metavar='FILE', help='write the results as CSV to FILE')
+    parser.add_argument('--json', metavar='FILE', help='write the results as JSON to FILE')
+    args = parser.parse_args()
+    if args.opt is None:
+        args.opt = ['O0', 'O2']
+    if args.count is None:
+        args.count = [0, 10, 50]
+    if args.repetitions < 1:
+        parser.error('--repetitions must be at least 1')
+    return args
+
+
+# Returns the commands which compile the module interface, and the flags which import it
+def module_commands(name : str, compiler : str, opt : str, flags : list, work : str):
+    bmi_dir = os.path.join(work, 'bmi.%s.%s' % (name, opt))
+    os.makedirs(bmi_dir, exist_ok=True)
+    obj = os.path.join(bmi_dir, 'outcome_v2_0.o')
+    if name == 'gcc':
+        mapper = os.path.join(bmi_dir, 'module-mapper')
+        with open(mapper, 'wt') as oh:
+            oh.write('outcome_v2_0 %s\n' % os.path.join(bmi_dir, 'outcome_v2_0.gcm'))
+        module_flags = ['-fmodules-ts', '-fmodule-mapper=' + mapper]
+        commands = [[compiler, '-std=c++20', '-' + opt] + module_flags + flags + ['-x', 'c++', '-c', interface, '-o', obj]]
+    else:
+        pcm = os.path.join(bmi_dir, 'outcome_v2_0.pcm')
+        module_flags = ['-fmodule-file=outcome_v2_0=' + pcm]
+        commands = [[compiler, '-std=c++20', '-' + opt] + flags + ['-x', 'c++-module', '--precompile', interface, '-o', pcm],
+                    [compiler, '-std=c++20', '-' + opt, '-c', pcm, '-o', obj]]
+    return commands, module_flags + ['-DOUTCOME_ENABLE_CXX_MODULES=1'], obj
+
+
+def measure(commands : list, repetitions : int):
+    times, cpus, memories = [], [], []
+    for _ in range(repetitions):
+        seconds, cpu, memory = 0, 0, 0
+        for command in commands:
+            s, c, m = run(command)
+            seconds += s
+            cpu = None if c is None or cpu is None else cpu + c
+            memory = None if m is None or memory is None else max(memory, m)
+        times.append(seconds)
+        cpus.append(cpu)
+        memories.append(memory)
+    return times, cpus, memories
+
+
+def main() -> int:
+    args = parse_args()
+    os.makedirs(args.work, exist_ok=True)
+    flags = args.flags.split()
+    results = []
+    failed = False
+    for spec in args.compiler:
+        name, _, compiler = spec.partition('=')
+        version = subprocess.check_output([compiler, '-dumpversion'], universal_newlines=True).strip()
+        for opt in args.opt:
+            # The module interface is compiled first, as the imports need it
+            editions = []
+            commands, import_flags, obj = module_commands(name, compiler, opt, flags, args.work)
+            editions.append(('module interface', None, commands, obj))
+            for count in args.count:
+                source = generate(args.work, count)
+                for edition, extra in (('include', []),
+                                       ('single header', ['-DOUTCOME_COMPILE_TIME_HEADER="%s"' % single_header.replace('\\', '/')]),
+                                       ('import', import_flags)):
+                    obj = os.path.join(args.work, 'compile_time_%d.%s.%s.%s.o' % (count, name, opt, edition.replace(' ', '_')))
+                    commands = [[compiler, '-std=c++20', '-' + opt] + extra + flags + ['-c', source, '-o', obj]]
+                    editions.append((edition, count, commands, obj))
+            module_built = True
+            for edition, count, commands, obj in editions:
+                if edition == 'import' and not module_built:
+                    continue
+                try:
+                    times, cpus, memories = measure(commands, args.repetitions)
+                except RuntimeError as e:
+                    print('[-] %s %s -%s %s%s failed: %s' % (name, version, opt, edition,
+                                                            '' if count is None else ', %d instantiations' % count, e))
+                    failed = True
+                    if edition == 'module interface':
+                        module_built = False
+                    continue
+                r = {
+                    'compiler': name,
+                    'version': version,
+                    'optimisation': opt,
+                    'edition': edition,
+                    'instantiations': count,
+                    'repetitions': args.repetitions,
+                    'seconds min': min(times),
+                    'seconds median': median(times),
+                    'cpu seconds min': None if None in cpus else min(cpus),
+                    'cpu seconds median': None if None in cpus else median(cpus),
+                    'peak memory MiB': None if None in memories else max(memories),
+                    'object bytes': os.path.getsize(obj),
+                }
+                results.append(r)
+                print('%s %s -%s %s%s, %d compiles: seconds min %f median %f, cpu seconds %s, peak memory %s MiB, object %d bytes'
+                      % (name, version, opt, edition, '' if count is None else ', %d instantiations' % count, args.repetitions,
+                         r['seconds min'], r['seconds median'],
+                         'unavailable' if r['cpu seconds min'] is None else 'min %f median %f' % (r['cpu seconds min'], r['cpu seconds median']),
+                         'unavailable' if r['peak memory MiB'] is None else '%.1f' % r['peak memory MiB'], r['object bytes']))
+    if args.csv is not None and results:
+        with open(args.csv, 'wt') as oh:
+            columns = list(results[0].keys())
+            oh.write(','.join('"%s"' % c for c in columns) + '\n')
+            for r in results:
+                oh.write(','.join('"%s"' % r[c] if isinstance(r[c], str) else ('' if r[c] is None else str(r[c])) for c in columns) + '\n')
+    if args.json is not None:
+        with open(args.json, 'wt') as oh:
+            json.dump(results, oh, indent=2)
+            oh.write('\n')
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
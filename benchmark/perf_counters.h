@@ -0,0 +1,124 @@
+/* perf_counters.h
+
+Reads hardware performance counters on Linux via perf_event_open(). Counters which
+cannot be opened, e.g. because perf is unavailable or forbidden by
+/proc/sys/kernel/perf_event_paranoid, or the CPU does not implement them, read as
+unavailable rather than failing the benchmark.
+*/
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <stdio.h>
+#include <string.h>
+
+#define PERF_COUNTERS_MAX 5
+
+typedef struct perf_counters_t
+{
+  int fds[PERF_COUNTERS_MAX];
+  const char *names[PERF_COUNTERS_MAX];
+  double values[PERF_COUNTERS_MAX];
+  int count;
+} perf_counters;
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static int perf_counters_open_one(unsigned type, unsigned long long config)
+{
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static void perf_counters_open(perf_counters *pc)
+{
+  static const struct
+  {
+    const char *name;
+    unsigned type;
+    unsigned long long config;
+  } events[PERF_COUNTERS_MAX] = {
+  {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+  {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+  {"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+  {"L1i-misses", PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1I | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+  {"frontend-stalls", PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_FRONTEND},
+  };
+  int n;
+  pc->count = PERF_COUNTERS_MAX;
+  for(n = 0; n < PERF_COUNTERS_MAX; n++)
+  {
+    pc->names[n] = events[n].name;
+    pc->fds[n] = perf_counters_open_one(events[n].type, events[n].config);
+    pc->values[n] = -1;
+  }
+}
+
+static void perf_counters_start(perf_counters *pc)
+{
+  int n;
+  for(n = 0; n < pc->count; n++)
+  {
+    if(pc->fds[n] >= 0)
+    {
+      ioctl(pc->fds[n], PERF_EVENT_IOC_RESET, 0);
+      ioctl(pc->fds[n], PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+}
+
+static void perf_counters_stop(perf_counters *pc)
+{
+  int n;
+  for(n = 0; n < pc->count; n++)
+  {
+    if(pc->fds[n] >= 0)
+    {
+      ioctl(pc->fds[n], PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+  for(n = 0; n < pc->count; n++)
+  {
+    /* value, time enabled, time running */
+    unsigned long long buffer[3];
+    pc->values[n] = -1;
+    if(pc->fds[n] >= 0 && read(pc->fds[n], buffer, sizeof(buffer)) == (ssize_t) sizeof(buffer) && buffer[2] != 0)
+    {
+      /* Scale up if the counter was multiplexed with others */
+      pc->values[n] = (double) buffer[0] * ((double) buffer[1] / (double) buffer[2]);
+    }
+  }
+}
+
+static void perf_counters_close(perf_counters *pc)
+{
+  int n;
+  for(n = 0; n < pc->count; n++)
+  {
+    if(pc->fds[n] >= 0)
+    {
+      close(pc->fds[n]);
+    }
+    pc->fds[n] = -1;
+  }
+}
+#else
+static void perf_counters_open(perf_counters *pc) { pc->count = 0; }
+static void perf_counters_start(perf_counters *pc) { (void) pc; }
+static void perf_counters_stop(perf_counters *pc) { (void) pc; }
+static void perf_counters_close(perf_counters *pc) { (void) pc; }
+#endif
+
+#endif
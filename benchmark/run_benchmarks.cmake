@@ -0,0 +1,36 @@
+# Runs each benchmark executable listed in BENCHMARKS, at each of its failure rates if
+# it has them, collecting their summaries into OUTPUT.csv and OUTPUT.json. Invoked by
+# the outcome-benchmark-run target.
+foreach(var BENCHMARKS OUTPUT WARMUP REPETITIONS ITERATIONS)
+  if(NOT DEFINED ${var})
+    message(FATAL_ERROR "${var} must be defined")
+  endif()
+endforeach()
+
+function(outcome_run_benchmark benchmark)
+  set(args --warmup ${WARMUP} --repetitions ${REPETITIONS} --iterations ${ITERATIONS} --csv "${OUTPUT}.csv" --json "${OUTPUT}.jsonl")
+  if(ARGN)
+    foreach(rate ${ARGN})
+      execute_process(COMMAND "${benchmark}" ${args} --failure-rate ${rate} RESULT_VARIABLE result)
+      if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${benchmark} failed with ${result}")
+      endif()
+    endforeach()
+  else()
+    execute_process(COMMAND "${benchmark}" ${args} RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+      message(FATAL_ERROR "${benchmark} failed with ${result}")
+    endif()
+  endif()
+endfunction()
+
+file(REMOVE "${OUTPUT}.csv" "${OUTPUT}.jsonl")
+# Calls outcome_run_benchmark() for each benchmark
+include("${BENCHMARKS}")
+
+# Each benchmark appended one JSON object per line, which become an array
+file(STRINGS "${OUTPUT}.jsonl" objects)
+string(REPLACE ";" ",\n  " objects "${objects}")
+file(WRITE "${OUTPUT}.json" "[\n  ${objects}\n]\n")
+file(REMOVE "${OUTPUT}.jsonl")
+message(STATUS "Benchmark results written to ${OUTPUT}.csv and ${OUTPUT}.json")
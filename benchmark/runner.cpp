@@ -1,37 +1,255 @@
+/* Runner for the call chain benchmark, built by CMakeLists.txt once per error handling
+system, value type and nesting depth.
+
+  runner [--warmup N] [--repetitions N] [--iterations N] [--failure-rate R] [--csv FILE] [--json FILE]
+
+Calls the top of the chain --warmup times untimed, then times --repetitions batches of
+--iterations calls, printing the minimum, median, mean and standard deviation per call of
+the wall time and each hardware performance counter across the batches. --csv appends them
+as a row to FILE, writing a header row first if FILE is empty, and --json appends them as a
+JSON object on one line. --failure-rate is the fraction of calls which fail, from 0 to 1, for
+the matrix systems only.
+*/
 #include "timing.h"
-#include "../include/outcome/result.hpp"
+#include "perf_counters.h"
+#include "chain.hpp"
+#include <algorithm>
+#include <random>
+#include <math.h>
 #include <stdio.h>
-#include <exception>
-#include "function.h"
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
 
-#define ITERATIONS 100000
-#define CPU_US_PER_CLOCK (1000000000000.0/(3292.0*1000000.0))
+#ifndef BENCHMARK_NAME
+#error BENCHMARK_NAME, BENCHMARK_TYPE_NAME and BENCHMARK_NESTING must be defined
+#endif
+
+extern benchmark_return_type BENCHMARK_FUNCTION(BENCHMARK_TOP)(int par BENCHMARK_OUT_PARAM);
 
 extern volatile int counter;
 volatile int counter, forcereturn;
 
-int main(void)
+#ifdef BENCHMARK_MATRIX
+static unsigned char failures[BENCHMARK_FAILURES_MASK + 1];
+const unsigned char *benchmark_failures = failures;
+
+// Fails round(rate * table size) entries of the table, spread by a fixed shuffle
+static void set_failure_rate(double rate)
 {
-  usCount start=GetUsCount();
-  while(GetUsCount()-start<1*1000000000000LL);
-  start=GetUsCount();
-  for(int n=0; n<ITERATIONS; n++)
+  const size_t count = (size_t)(rate * (BENCHMARK_FAILURES_MASK + 1) + 0.5);
+  for(size_t n = 0; n <= BENCHMARK_FAILURES_MASK; n++)
   {
+    failures[n] = n < count;
+  }
+  std::mt19937 gen(78);
+  std::shuffle(failures, failures + BENCHMARK_FAILURES_MASK + 1, gen);
+}
+#endif
+
+static inline void call_chain(int n)
+{
+#ifdef BENCHMARK_MATRIX_OPTIONAL_OUT_PARAM
+  std::error_code ec;
+#endif
 #if !defined(_CPPUNWIND) && !defined(__EXCEPTIONS)
-    forcereturn += !FUNCTION(n);
+  forcereturn += benchmark_failed(BENCHMARK_FUNCTION(BENCHMARK_TOP)(n BENCHMARK_OUT_ARG));
 #else
-    try
+  try
+  {
+    forcereturn += benchmark_failed(BENCHMARK_FUNCTION(BENCHMARK_TOP)(n BENCHMARK_OUT_ARG));
+  }
+  catch(const std::exception &)
+  {
+  }
+#endif
+}
+
+// Summary statistics of one measurement across repetitions, each per call
+struct summary
+{
+  const char *name;
+  bool available;
+  double min, median, mean, stddev;
+};
+
+static summary summarise(const char *name, std::vector<double> values)
+{
+  summary s = {name, true, 0, 0, 0, 0};
+  for(double v : values)
+  {
+    if(v < 0)
     {
-      forcereturn += !FUNCTION(n);
+      s.available = false;
+      return s;
     }
-    catch(const std::exception &)
+    s.mean += v;
+  }
+  std::sort(values.begin(), values.end());
+  const size_t count = values.size();
+  s.min = values.front();
+  s.median = (count % 2) ? values[count / 2] : (values[count / 2 - 1] + values[count / 2]) / 2;
+  s.mean /= count;
+  for(double v : values)
+  {
+    s.stddev += (v - s.mean) * (v - s.mean);
+  }
+  s.stddev = (count > 1) ? sqrt(s.stddev / (count - 1)) : 0;
+  return s;
+}
+
+static int usage(const char *argv0)
+{
+  fprintf(stderr, "Usage: %s [--warmup N] [--repetitions N] [--iterations N] [--failure-rate R] [--csv FILE] [--json FILE]\n", argv0);
+  return 1;
+}
+
+int main(int argc, char *argv[])
+{
+  long warmup = 10000, repetitions = 20, iterations = 10000;
+  double failure_rate = -1;
+  const char *csv = nullptr, *json = nullptr;
+  for(int n = 1; n < argc; n++)
+  {
+    if(n + 1 == argc)
     {
+      return usage(argv[0]);
     }
+    if(!strcmp(argv[n], "--warmup"))
+      warmup = atol(argv[++n]);
+    else if(!strcmp(argv[n], "--repetitions"))
+      repetitions = atol(argv[++n]);
+    else if(!strcmp(argv[n], "--iterations"))
+      iterations = atol(argv[++n]);
+    else if(!strcmp(argv[n], "--failure-rate"))
+      failure_rate = atof(argv[++n]);
+    else if(!strcmp(argv[n], "--csv"))
+      csv = argv[++n];
+    else if(!strcmp(argv[n], "--json"))
+      json = argv[++n];
+    else
+      return usage(argv[0]);
+  }
+  if(warmup < 0 || repetitions < 1 || iterations < 1)
+  {
+    return usage(argv[0]);
+  }
+#ifdef BENCHMARK_MATRIX
+  if(failure_rate < 0)
+  {
+    failure_rate = 0;
+  }
+  if(failure_rate > 1)
+  {
+    return usage(argv[0]);
+  }
+  set_failure_rate(failure_rate);
+#else
+  if(failure_rate >= 0)
+  {
+    fprintf(stderr, "%s always fails or always succeeds, so --failure-rate does not apply\n", BENCHMARK_NAME);
+    return 1;
+  }
 #endif
+
+  perf_counters pc;
+  perf_counters_open(&pc);
+
+  // Get the CPU out of any power saving state, and the chain into the caches
+  for(long n = 0; n < warmup; n++)
+  {
+    call_chain((int) n);
+  }
+
+  std::vector<double> times;
+  std::vector<std::vector<double>> counters(pc.count);
+  for(long r = 0; r < repetitions; r++)
+  {
+    perf_counters_start(&pc);
+    usCount start = GetUsCount();
+    for(long n = 0; n < iterations; n++)
+    {
+      call_chain((int) n);
+    }
+    usCount end = GetUsCount();
+    perf_counters_stop(&pc);
+    // GetUsCount() is in picoseconds
+    times.push_back((double) (end - start) / 1000.0 / iterations);
+    for(int n = 0; n < pc.count; n++)
+    {
+      counters[n].push_back((pc.values[n] >= 0) ? pc.values[n] / iterations : -1);
+    }
+  }
+  perf_counters_close(&pc);
+
+  std::vector<summary> summaries(1, summarise("ns", times));
+  for(int n = 0; n < pc.count; n++)
+  {
+    summaries.push_back(summarise(pc.names[n], counters[n]));
+  }
+
+  // The baseline systems have no failure rate, so leave it empty
+  char failure_rate_text[32] = "";
+  if(failure_rate >= 0)
+  {
+    snprintf(failure_rate_text, sizeof(failure_rate_text), "%g", failure_rate);
+  }
+
+  printf("%s of %s, nesting %d, failure rate %s, %ld repetitions of %ld calls, per call:\n", BENCHMARK_NAME, BENCHMARK_TYPE_NAME, BENCHMARK_NESTING, (failure_rate >= 0) ? failure_rate_text : "n/a", repetitions, iterations);
+  for(const summary &s : summaries)
+  {
+    if(s.available)
+      printf("  %16s: min %f median %f mean %f stddev %f\n", s.name, s.min, s.median, s.mean, s.stddev);
+    else
+      printf("  %16s: unavailable\n", s.name);
+  }
+  if(csv != nullptr)
+  {
+    FILE *f = fopen(csv, "a");
+    if(f == nullptr)
+    {
+      perror(csv);
+      return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    if(ftell(f) == 0)
+    {
+      fprintf(f, "\"benchmark\",\"type\",\"nesting\",\"failure rate\",\"repetitions\",\"iterations\"");
+      for(const summary &s : summaries)
+      {
+        fprintf(f, ",\"%s min\",\"%s median\",\"%s mean\",\"%s stddev\"", s.name, s.name, s.name, s.name);
+      }
+      fprintf(f, "\n");
+    }
+    fprintf(f, "\"%s\",\"%s\",%d,%s,%ld,%ld", BENCHMARK_NAME, BENCHMARK_TYPE_NAME, BENCHMARK_NESTING, failure_rate_text, repetitions, iterations);
+    for(const summary &s : summaries)
+    {
+      if(s.available)
+        fprintf(f, ",%f,%f,%f,%f", s.min, s.median, s.mean, s.stddev);
+      else
+        fprintf(f, ",,,,");
+    }
+    fprintf(f, "\n");
+    fclose(f);
+  }
+  if(json != nullptr)
+  {
+    FILE *f = fopen(json, "a");
+    if(f == nullptr)
+    {
+      perror(json);
+      return 1;
+    }
+    fprintf(f, "{\"benchmark\": \"%s\", \"type\": \"%s\", \"nesting\": %d, \"failure rate\": %s, \"repetitions\": %ld, \"iterations\": %ld", BENCHMARK_NAME, BENCHMARK_TYPE_NAME, BENCHMARK_NESTING, (failure_rate >= 0) ? failure_rate_text : "null", repetitions, iterations);
+    for(const summary &s : summaries)
+    {
+      if(s.available)
+        fprintf(f, ", \"%s\": {\"min\": %f, \"median\": %f, \"mean\": %f, \"stddev\": %f}", s.name, s.min, s.median, s.mean, s.stddev);
+      else
+        fprintf(f, ", \"%s\": null", s.name);
+    }
+    fprintf(f, "}\n");
+    fclose(f);
   }
-  double time=GetUsCount()-start;
-  time/=ITERATIONS;
-  double ticks=time/CPU_US_PER_CLOCK/*/NESTING*/;
-  printf("%f\n", ticks);
   return 0;
 }
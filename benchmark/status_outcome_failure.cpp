@@ -0,0 +1,61 @@
+/* Benchmark of status_outcome<T>::failure() at various failure rates
+Compares making the exception pointer via the domain hook against throwing and
+catching the status code. Prints CSV of failure percentage followed by
+nanoseconds per outcome for each way.
+*/
+#include "timing.h"
+#include "../include/outcome/experimental/status_outcome.hpp"
+#include <stdio.h>
+#include <vector>
+
+#define ITERATIONS 100000
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+using SYSTEM_ERROR2_NAMESPACE::errc;
+using SYSTEM_ERROR2_NAMESPACE::generic_code;
+
+template <class F> static double run(const std::vector<outcome::experimental::status_outcome<int>> &outcomes, F &&convert)
+{
+  size_t boxed = 0;
+  usCount start = GetUsCount();
+  for(int n = 0; n < ITERATIONS; n++)
+  {
+    const auto &o = outcomes[n % outcomes.size()];
+    if(o.has_error())
+    {
+      boxed += !!convert(o);
+    }
+  }
+  usCount end = GetUsCount();
+  if(boxed == 0 && outcomes.front().has_error())
+  {
+    fprintf(stderr, "FATAL: nothing was converted\n");
+  }
+  // Picoseconds to nanoseconds per outcome
+  return (double) (end - start) / 1000.0 / ITERATIONS;
+}
+
+int main(void)
+{
+  static const int rates[] = {1, 10, 50, 90, 100};
+  printf("failure %%,throw ns,hook ns\n");
+  for(int rate : rates)
+  {
+    std::vector<outcome::experimental::status_outcome<int>> outcomes;
+    for(int n = 0; n < 100; n++)
+    {
+      if(n < rate)
+      {
+        outcomes.emplace_back(generic_code(errc::no_such_file_or_directory));
+      }
+      else
+      {
+        outcomes.emplace_back(n);
+      }
+    }
+    double thrown = run(outcomes, [](const outcome::experimental::status_outcome<int> &o) { return outcome::detail::adl::status_code_exception_ptr_by_throw(o.error()); });
+    double hooked = run(outcomes, [](const outcome::experimental::status_outcome<int> &o) { return o.failure(); });
+    printf("%d,%f,%f\n", rate, thrown, hooked);
+  }
+  return 0;
+}
@@ -2,16 +2,26 @@
 set(outcome_TESTS
   "test/expected-pass.cpp"
   "test/single-header-test.cpp"
+  "test/tests/allocations.cpp"
+  "test/tests/binary-log.cpp"
+  "test/tests/binary-serialisation.cpp"
+  "test/tests/c-bulk.cpp"
   "test/tests/comparison.cpp"
   "test/tests/constexpr.cpp"
   "test/tests/containers.cpp"
+  "test/tests/core-header-set.cpp"
   "test/tests/core-outcome.cpp"
   "test/tests/core-result.cpp"
   "test/tests/default-construction.cpp"
+  "test/tests/error-from-exception.cpp"
+  "test/tests/error-message-cache.cpp"
+  "test/tests/extern-templates.cpp"
   "test/tests/experimental-core-outcome-status.cpp"
   "test/tests/experimental-core-result-status.cpp"
   "test/tests/experimental-p0709a.cpp"
   "test/tests/fileopen.cpp"
+  "test/tests/format-support.cpp"
+  "test/tests/from-chars.cpp"
   "test/tests/hooks.cpp"
   "test/tests/issue0007.cpp"
   "test/tests/issue0009.cpp"
@@ -27,12 +37,15 @@ set(outcome_TESTS
   "test/tests/issue0115.cpp"
   "test/tests/issue0116.cpp"
   "test/tests/issue0140.cpp"
+  "test/tests/log-violations.cpp"
   "test/tests/noexcept-propagation.cpp"
   "test/tests/propagate.cpp"
+  "test/tests/sampled-narrow.cpp"
   "test/tests/serialisation.cpp"
   "test/tests/success-failure.cpp"
   "test/tests/swap.cpp"
   "test/tests/udts.cpp"
+  "test/tests/unobserved-failures.cpp"
   "test/tests/value-or-error.cpp"
 )
 # DO NOT EDIT, GENERATED BY SCRIPT
@@ -44,4 +57,5 @@ set(outcome_COMPILE_FAIL_TESTS
   "test/compile-fail/outcome-int-int-1.cpp"
   "test/compile-fail/result-int-int-1.cpp"
   "test/compile-fail/result-int-int-2.cpp"
+  "test/compile-fail/spare-storage-overlap.cpp"
 )
@@ -22,10 +22,18 @@ Distributed under the Boost Software License, Version 1.0.
 http://www.boost.org/LICENSE_1_0.txt)
 */
 
-#if defined(__cpp_modules) && !defined(GENERATING_OUTCOME_MODULE_INTERFACE)
+#if(defined(__cpp_modules) || defined(OUTCOME_ENABLE_CXX_MODULES)) && !defined(GENERATING_OUTCOME_MODULE_INTERFACE)
 import outcome_v2_0;
+// A module exports no macros, so also bring in those of the headers
+#define IMPORTING_OUTCOME_MODULE
+#include "outcome/config.hpp"
+#include "outcome/try.hpp"
 #else
 #include "outcome/iostream_support.hpp"
 #include "outcome/try.hpp"
 #include "outcome/utils.hpp"
+#if defined(OUTCOME_USE_EXTERN_TEMPLATES)
+// The common results and outcomes are instantiated by the compiled library outcome::sl
+#include "outcome/extern_templates.hpp"
+#endif
 #endif
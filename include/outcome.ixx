@@ -1,3 +1,37 @@
+// The global module fragment holds everything the headers include from outside
+// Outcome, so none of it becomes attached to the module
+module;
+#include "quickcpplib/include/config.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <initializer_list>
+#include <iosfwd>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#if defined(__has_include)
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#endif
+#endif
+
 // Tell the headers we are generating the interface for the library
 #define GENERATING_OUTCOME_MODULE_INTERFACE
 export module outcome_v2_0;  // OUTCOME_MODULE_NAME
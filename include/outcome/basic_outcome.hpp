@@ -57,39 +57,72 @@ namespace detail
     && !detail::is_implicitly_constructible<exception_type, value_type>  //
     && !detail::is_implicitly_constructible<exception_type, error_type>;
 
-    // Predicate for the value converting constructor to be available.
+    // The traits of the value, error and exception converting constructor predicates, which
+    // are only instantiated if Enable, see result_predicates::converting_constructor.
+    template <bool Enable, class T> struct converting_constructor
+    {
+      static constexpr bool value = false;
+      static constexpr bool error = false;
+      static constexpr bool exception = false;
+    };
+    template <class T> struct converting_constructor<true, T>
+    {
+      using result_converting_constructor = typename result::template converting_constructor<true, T>;
+      static constexpr bool not_exception_type = !detail::is_implicitly_constructible<exception_type, T>;  // deliberately less tolerant of ambiguity than result's edition
+      static constexpr bool value = result_converting_constructor::value && not_exception_type;
+      static constexpr bool error = result_converting_constructor::error && not_exception_type;
+      static constexpr bool exception = !detail::is_implicitly_constructible<value_type, T> && !detail::is_implicitly_constructible<error_type, T> && detail::is_implicitly_constructible<exception_type, T>;
+    };
+
+    // Predicate for T to be considered by the value, error and exception converting constructors at all
     template <class T>
-    static constexpr bool enable_value_converting_constructor =  //
-    implicit_constructors_enabled                                //
-    &&result::template enable_value_converting_constructor<T>    //
-    && !detail::is_implicitly_constructible<exception_type, T>;  // deliberately less tolerant of ambiguity than result's edition
+    static constexpr bool converting_constructor_candidate =  //
+    implicit_constructors_enabled                             //
+    && !is_in_place_type_t<std::decay_t<T>>::value;           // not in place construction
+
+    // Predicate for the value converting constructor to be available.
+    template <class T> static constexpr bool enable_value_converting_constructor = converting_constructor<converting_constructor_candidate<T>, T>::value;
 
     // Predicate for the error converting constructor to be available.
-    template <class T>
-    static constexpr bool enable_error_converting_constructor =  //
-    implicit_constructors_enabled                                //
-    &&result::template enable_error_converting_constructor<T>    //
-    && !detail::is_implicitly_constructible<exception_type, T>;  // deliberately less tolerant of ambiguity than result's edition
+    template <class T> static constexpr bool enable_error_converting_constructor = converting_constructor<converting_constructor_candidate<T>, T>::error;
 
-    // Predicate for the error condition converting constructor to be available.
-    template <class ErrorCondEnum>
-    static constexpr bool enable_error_condition_converting_constructor = result::template enable_error_condition_converting_constructor<ErrorCondEnum>  //
-                                                                          && !detail::is_implicitly_constructible<exception_type, ErrorCondEnum>;
+    // Predicate for the error condition converting constructor to be available, only instantiated if Enable.
+    template <bool Enable, class ErrorCondEnum> struct error_condition_converting_constructor
+    {
+      static constexpr bool value = false;
+    };
+    template <class ErrorCondEnum> struct error_condition_converting_constructor<true, ErrorCondEnum>
+    {
+      static constexpr bool value = result::template enable_error_condition_converting_constructor<ErrorCondEnum>  //
+                                    && !detail::is_implicitly_constructible<exception_type, ErrorCondEnum>;
+    };
+    template <class ErrorCondEnum> static constexpr bool enable_error_condition_converting_constructor = error_condition_converting_constructor<true, ErrorCondEnum>::value;
 
     // Predicate for the exception converting constructor to be available.
-    template <class T>
-    static constexpr bool enable_exception_converting_constructor =  //
-    implicit_constructors_enabled                                    //
-    && !is_in_place_type_t<std::decay_t<T>>::value                   // not in place construction
-    && !detail::is_implicitly_constructible<value_type, T> && !detail::is_implicitly_constructible<error_type, T> && detail::is_implicitly_constructible<exception_type, T>;
+    template <class T> static constexpr bool enable_exception_converting_constructor = converting_constructor<converting_constructor_candidate<T>, T>::exception;
 
-    // Predicate for the error + exception converting constructor to be available.
-    template <class T, class U>
-    static constexpr bool enable_error_exception_converting_constructor =                                         //
-    implicit_constructors_enabled                                                                                 //
-    && !is_in_place_type_t<std::decay_t<T>>::value                                                                // not in place construction
-    && !detail::is_implicitly_constructible<value_type, T> && detail::is_implicitly_constructible<error_type, T>  //
-    && !detail::is_implicitly_constructible<value_type, U> && detail::is_implicitly_constructible<exception_type, U>;
+    // Predicate for the error + exception converting constructor to be available, only instantiated if Enable.
+    template <bool Enable, class T, class U> struct error_exception_converting_constructor
+    {
+      static constexpr bool value = false;
+    };
+    template <class T, class U> struct error_exception_converting_constructor<true, T, U>
+    {
+      static constexpr bool value =                                                                                 //
+      !detail::is_implicitly_constructible<value_type, T> && detail::is_implicitly_constructible<error_type, T>  //
+      && !detail::is_implicitly_constructible<value_type, U> && detail::is_implicitly_constructible<exception_type, U>;
+    };
+    template <class T, class U> static constexpr bool enable_error_exception_converting_constructor = error_exception_converting_constructor<converting_constructor_candidate<T>, T, U>::value;
+
+    // Predicate for the deleted constructor which reports that implicit construction is disabled, only instantiated if Enable.
+    template <bool Enable, class T> struct disabled_implicit_constructor
+    {
+      static constexpr bool value = false;
+    };
+    template <class T> struct disabled_implicit_constructor<true, T>
+    {
+      static constexpr bool value = detail::is_implicitly_constructible<value_type, T> || detail::is_implicitly_constructible<error_type, T> || detail::is_implicitly_constructible<exception_type, T>;
+    };
 
     // Predicate for the converting copy constructor from a compatible outcome to be available.
     template <class T, class U, class V, class W>
@@ -121,9 +154,9 @@ namespace detail
   };
 
   // Select whether to use basic_outcome_failure_observers or not
-  template <class Base, class R, class S, class P, class NoValuePolicy>
+  template <class R, class S, class P, class NoValuePolicy>
   using select_basic_outcome_failure_observers =  //
-  std::conditional_t<trait::has_error_code<S>::value && trait::has_exception_ptr<P>::value, basic_outcome_failure_observers<Base, R, S, P, NoValuePolicy>, Base>;
+  std::conditional_t<trait::has_error_code<S>::value && trait::has_exception_ptr<P>::value, basic_outcome_failure_observers<R, S, P, NoValuePolicy>, basic_outcome_exception_observers<R, S, P, NoValuePolicy>>;
 
   template <class T, class U, class V> constexpr inline const V &extract_exception_from_failure(const failure_type<U, V> &v) { return v.exception(); }
   template <class T, class U, class V> constexpr inline V &&extract_exception_from_failure(failure_type<U, V> &&v) { return static_cast<failure_type<U, V> &&>(v).exception(); }
@@ -143,7 +176,7 @@ namespace detail
 //! True if an outcome
 template <class T> using is_basic_outcome = detail::is_basic_outcome<std::decay_t<T>>;
 //! True if an outcome
-template <class T> static constexpr bool is_basic_outcome_v = detail::is_basic_outcome<std::decay_t<T>>::value;
+template <class T> OUTCOME_INLINE_CONSTEXPR bool is_basic_outcome_v = detail::is_basic_outcome<std::decay_t<T>>::value;
 
 namespace hooks
 {
@@ -180,6 +213,19 @@ namespace hooks
   WARNING: The compiler is permitted to elide calls to constructors, and thus this hook may not get called when you think it should!
   */
   template <class T, class U, class... Args> constexpr inline void hook_outcome_in_place_construction(T * /*unused*/, in_place_type_t<U> /*unused*/, Args &&... /*unused*/) noexcept {}
+  /*! The default observation hook implementation called when `exception()` or `assume_exception()` is called
+  on an `outcome`. Does nothing, unless `OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING` is defined, in which case it marks
+  the state as observed.
+  \param 1 Some `outcome<...>` being observed.
+  */
+  template <class T> constexpr inline OUTCOME_DEBUG_INLINE void hook_outcome_exception_observation(const T *r) noexcept
+  {
+#ifdef OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING
+    mark_as_observed(r);
+#else
+    (void) r;
+#endif
+  }
 
   //! Used in hook implementations to override the exception to something other than what was constructed.
   template <class R, class S, class P, class NoValuePolicy, class U> constexpr inline void override_outcome_exception(basic_outcome<R, S, P, NoValuePolicy> *o, U &&v) noexcept;
@@ -205,16 +251,16 @@ template <class R, class S, class P, class NoValuePolicy>
 OUTCOME_REQUIRES(trait::type_can_be_used_in_basic_result<P> && (std::is_void<P>::value || std::is_default_constructible<P>::value))  //
 class OUTCOME_NODISCARD basic_outcome
 #if defined(DOXYGEN_IS_IN_THE_HOUSE) || defined(STANDARDESE_IS_IN_THE_HOUSE)
-: public detail::basic_outcome_failure_observers<detail::basic_result_final<R, S, P, NoValuePolicy>, R, S, P, NoValuePolicy>,
-  public detail::basic_outcome_exception_observers<detail::basic_result_final<R, S, NoValuePolicy>, R, S, P, NoValuePolicy>,
+: public detail::basic_outcome_failure_observers<R, S, P, NoValuePolicy>,
+  public detail::basic_outcome_exception_observers<R, S, P, NoValuePolicy>,
   public detail::basic_result_final<R, S, NoValuePolicy>
 #else
-: public detail::select_basic_outcome_failure_observers<detail::basic_outcome_exception_observers<detail::basic_result_final<R, S, NoValuePolicy>, R, S, P, NoValuePolicy>, R, S, P, NoValuePolicy>
+: public detail::select_basic_outcome_failure_observers<R, S, P, NoValuePolicy>
 #endif
 {
   static_assert(trait::type_can_be_used_in_basic_result<P>, "The exception_type cannot be used");
   static_assert(std::is_void<P>::value || std::is_default_constructible<P>::value, "exception_type must be void or default constructible");
-  using base = detail::select_basic_outcome_failure_observers<detail::basic_outcome_exception_observers<detail::basic_result_final<R, S, NoValuePolicy>, R, S, P, NoValuePolicy>, R, S, P, NoValuePolicy>;
+  using base = detail::select_basic_outcome_failure_observers<R, S, P, NoValuePolicy>;
   friend struct policy::base;
   template <class T, class U, class V, class W> friend class basic_outcome;
   template <class T, class U, class V, class W, class X> friend constexpr inline void hooks::override_outcome_exception(basic_outcome<T, U, V, W> *o, X &&v) noexcept;  // NOLINT
@@ -286,40 +332,34 @@ protected:
     // Predicate for implicit constructors to be available at all
     static constexpr bool implicit_constructors_enabled = constructors_enabled && base::implicit_constructors_enabled;
 
-    //! Predicate for the value converting constructor to be available.
+    // Predicate for T to be considered by the value, error and exception converting constructors at all
     template <class T>
-    static constexpr bool enable_value_converting_constructor =  //
-    constructors_enabled                                         //
-    && !std::is_same<std::decay_t<T>, basic_outcome>::value      // not my type
-    && base::template enable_value_converting_constructor<T>;
+    static constexpr bool converting_constructor_candidate =  //
+    constructors_enabled                                      //
+    && !std::is_same<std::decay_t<T>, basic_outcome>::value   // not my type
+    && base::template converting_constructor_candidate<T>;
+
+    //! Predicate for the value converting constructor to be available.
+    template <class T> static constexpr bool enable_value_converting_constructor = base::template converting_constructor<converting_constructor_candidate<T>, T>::value;
 
     //! Predicate for the error converting constructor to be available.
-    template <class T>
-    static constexpr bool enable_error_converting_constructor =  //
-    constructors_enabled                                         //
-    && !std::is_same<std::decay_t<T>, basic_outcome>::value      // not my type
-    && base::template enable_error_converting_constructor<T>;
+    template <class T> static constexpr bool enable_error_converting_constructor = base::template converting_constructor<converting_constructor_candidate<T>, T>::error;
 
     //! Predicate for the error condition converting constructor to be available.
     template <class ErrorCondEnum>
     static constexpr bool enable_error_condition_converting_constructor =  //
-    constructors_enabled                                                   //
-    && !std::is_same<std::decay_t<ErrorCondEnum>, basic_outcome>::value    // not my type
-    && base::template enable_error_condition_converting_constructor<ErrorCondEnum>;
+    base::template error_condition_converting_constructor<constructors_enabled && !std::is_same<std::decay_t<ErrorCondEnum>, basic_outcome>::value, ErrorCondEnum>::value;
 
     // Predicate for the exception converting constructor to be available.
-    template <class T>
-    static constexpr bool enable_exception_converting_constructor =  //
-    constructors_enabled                                             //
-    && !std::is_same<std::decay_t<T>, basic_outcome>::value          // not my type
-    && base::template enable_exception_converting_constructor<T>;
+    template <class T> static constexpr bool enable_exception_converting_constructor = base::template converting_constructor<converting_constructor_candidate<T>, T>::exception;
 
     // Predicate for the error + exception converting constructor to be available.
-    template <class T, class U>
-    static constexpr bool enable_error_exception_converting_constructor =  //
-    constructors_enabled                                                   //
-    && !std::is_same<std::decay_t<T>, basic_outcome>::value                // not my type
-    && base::template enable_error_exception_converting_constructor<T, U>;
+    template <class T, class U> static constexpr bool enable_error_exception_converting_constructor = base::template error_exception_converting_constructor<converting_constructor_candidate<T>, T, U>::value;
+
+    //! Predicate for the deleted constructor which reports that implicit construction is disabled to be available.
+    template <class T>
+    static constexpr bool enable_disabled_implicit_constructor =  //
+    base::template disabled_implicit_constructor<constructors_enabled && !implicit_constructors_enabled, T>::value;
 
     //! Predicate for the converting constructor from a compatible input to be available.
     template <class T, class U, class V, class W>
@@ -390,8 +430,7 @@ public:
   that `value_type` or `error_type` or `exception_type` are ambiguous, whilst also preserving compile-time introspection.
   */
   OUTCOME_TEMPLATE(class T)
-  OUTCOME_TREQUIRES(OUTCOME_TPRED((predicate::constructors_enabled && !predicate::implicit_constructors_enabled  //
-                                   && (detail::is_implicitly_constructible<value_type, T> || detail::is_implicitly_constructible<error_type, T> || detail::is_implicitly_constructible<exception_type, T>) )))
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_disabled_implicit_constructor<T>))
   basic_outcome(T && /*unused*/, implicit_constructors_disabled_tag /*unused*/ = implicit_constructors_disabled_tag()) = delete;  // NOLINT Implicit constructors disabled, use explicit in_place_type<T>, success() or failure(). see docs!
 
   /// \output_section Converting constructors
@@ -452,8 +491,8 @@ public:
   \throws Any exception the construction of `error_type(make_error_code(t))` might throw.
   */
   OUTCOME_TEMPLATE(class ErrorCondEnum)
-  OUTCOME_TREQUIRES(OUTCOME_TEXPR(error_type(make_error_code(ErrorCondEnum()))),  //
-                    OUTCOME_TPRED(predicate::template enable_error_condition_converting_constructor<ErrorCondEnum>))
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_error_condition_converting_constructor<ErrorCondEnum>),  // checked first to save the lookup below
+                    OUTCOME_TEXPR(error_type(make_error_code(ErrorCondEnum()))))
   constexpr basic_outcome(ErrorCondEnum &&t, error_condition_converting_constructor_tag /*unused*/ = error_condition_converting_constructor_tag()) noexcept(noexcept(error_type(make_error_code(static_cast<ErrorCondEnum &&>(t)))))  // NOLINT
   : base{in_place_type<typename base::_error_type>, make_error_code(t)}
   {
@@ -30,7 +30,6 @@ http://www.boost.org/LICENSE_1_0.txt)
 #include "detail/basic_result_final.hpp"
 
 #include "policy/all_narrow.hpp"
-#include "policy/terminate.hpp"
 
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -58,26 +57,52 @@ namespace detail
             && !detail::is_implicitly_constructible<error_type, value_type>                                                             // AND which cannot be constructed from the value type
             && std::is_integral<value_type>::value));                                                                                   // AND the value type is some integral type
 
-    // Predicate for the value converting constructor to be available. Weakened to allow result<int, C enum>.
+    /* The traits of the value and error converting constructor predicates, which are only
+    instantiated if Enable. Every single argument construction of every distinct result
+    considers the converting constructors, including its copies and moves, so callers
+    pass in cheap checks ruling those out before any conversion traits are instantiated.
+    */
+    template <bool Enable, class T> struct converting_constructor
+    {
+      static constexpr bool value = false;
+      static constexpr bool error = false;
+    };
+    template <class T> struct converting_constructor<true, T>
+    {
+      static constexpr bool not_error_type_enum = !trait::is_error_type_enum<error_type, std::decay_t<T>>::value;  // not an enum valid for my error type
+      static constexpr bool value =                                                                                 //
+      not_error_type_enum                                                                                           //
+      && ((detail::is_implicitly_constructible<value_type, T> && !detail::is_implicitly_constructible<error_type, T>)  // is unambiguously for value type
+          || (std::is_same<value_type, std::decay_t<T>>::value                                                         // OR is my value type exactly
+              && detail::is_implicitly_constructible<value_type, T>) );                                                // and my value type is constructible from this ref form of T
+      static constexpr bool error =                                                                                 //
+      not_error_type_enum                                                                                           //
+      && ((!detail::is_implicitly_constructible<value_type, T> && detail::is_implicitly_constructible<error_type, T>)  // is unambiguously for error type
+          || (std::is_same<error_type, std::decay_t<T>>::value                                                         // OR is my error type exactly
+              && detail::is_implicitly_constructible<error_type, T>) );                                                // and my error type is constructible from this ref form of T
+    };
+
+    // Predicate for T to be considered by the value and error converting constructors at all
     template <class T>
-    static constexpr bool enable_value_converting_constructor =                                                      //
-    implicit_constructors_enabled                                                                                    //
-    && !is_in_place_type_t<std::decay_t<T>>::value                                                                   // not in place construction
-    && !trait::is_error_type_enum<error_type, std::decay_t<T>>::value                                                // not an enum valid for my error type
-    && ((detail::is_implicitly_constructible<value_type, T> && !detail::is_implicitly_constructible<error_type, T>)  // is unambiguously for value type
-        || (std::is_same<value_type, std::decay_t<T>>::value                                                         // OR is my value type exactly
-            && detail::is_implicitly_constructible<value_type, T>) );                                                // and my value type is constructible from this ref form of T
+    static constexpr bool converting_constructor_candidate =  //
+    implicit_constructors_enabled                             //
+    && !is_in_place_type_t<std::decay_t<T>>::value;           // not in place construction
 
+    // Predicate for the value converting constructor to be available. Weakened to allow result<int, C enum>.
+    template <class T> static constexpr bool enable_value_converting_constructor = converting_constructor<converting_constructor_candidate<T>, T>::value;
 
     // Predicate for the error converting constructor to be available. Weakened to allow result<int, C enum>.
-    template <class T>
-    static constexpr bool enable_error_converting_constructor =                                                      //
-    implicit_constructors_enabled                                                                                    //
-    && !is_in_place_type_t<std::decay_t<T>>::value                                                                   // not in place construction
-    && !trait::is_error_type_enum<error_type, std::decay_t<T>>::value                                                // not an enum valid for my error type
-    && ((!detail::is_implicitly_constructible<value_type, T> && detail::is_implicitly_constructible<error_type, T>)  // is unambiguously for error type
-        || (std::is_same<error_type, std::decay_t<T>>::value                                                         // OR is my error type exactly
-            && detail::is_implicitly_constructible<error_type, T>) );                                                // and my error type is constructible from this ref form of T
+    template <class T> static constexpr bool enable_error_converting_constructor = converting_constructor<converting_constructor_candidate<T>, T>::error;
+
+    // Predicate for the deleted constructor which reports that implicit construction is disabled, only instantiated if Enable.
+    template <bool Enable, class T> struct disabled_implicit_constructor
+    {
+      static constexpr bool value = false;
+    };
+    template <class T> struct disabled_implicit_constructor<true, T>
+    {
+      static constexpr bool value = detail::is_implicitly_constructible<value_type, T> || detail::is_implicitly_constructible<error_type, T>;
+    };
 
     // Predicate for the error condition converting constructor to be available.
     template <class ErrorCondEnum>
@@ -127,12 +152,47 @@ namespace detail
   {
     static constexpr bool value = true;
   };
+
+  // Helpers for hooks::spare_storage_registry
+  constexpr inline bool spare_storage_fields_disjoint(std::initializer_list<uint16_t> masks) noexcept
+  {
+    uint16_t used = 0;
+    for(uint16_t mask : masks)
+    {
+      if((used & mask) != 0)
+      {
+        return false;
+      }
+      used |= mask;
+    }
+    return true;
+  }
+  constexpr inline uint16_t spare_storage_fields_used(std::initializer_list<uint16_t> masks) noexcept
+  {
+    uint16_t used = 0;
+    for(uint16_t mask : masks)
+    {
+      used |= mask;
+    }
+    return used;
+  }
+  constexpr inline unsigned spare_storage_first_fit(uint16_t used, unsigned bits) noexcept
+  {
+    for(unsigned offset = 0; offset + bits <= 16; offset++)
+    {
+      if((used & (((1U << bits) - 1) << offset)) == 0)
+      {
+        return offset;
+      }
+    }
+    return 16;  // fails the static_assert in spare_storage_field
+  }
 }  // namespace detail
 
 //! True if a `basic_result`
 template <class T> using is_basic_result = detail::is_basic_result<std::decay_t<T>>;
 //! True if a `basic_result`
-template <class T> static constexpr bool is_basic_result_v = detail::is_basic_result<std::decay_t<T>>::value;
+template <class T> OUTCOME_INLINE_CONSTEXPR bool is_basic_result_v = detail::is_basic_result<std::decay_t<T>>::value;
 
 //! Namespace for ADL discovered hooks into events in `result` and `outcome`.
 namespace hooks
@@ -173,8 +233,173 @@ namespace hooks
 
   //! Retrieves the 16 bits of spare storage in result/outcome.
   template <class R, class S, class NoValuePolicy> constexpr inline uint16_t spare_storage(const detail::basic_result_final<R, S, NoValuePolicy> *r) noexcept { return (r->_state._status >> detail::status_2byte_shift) & 0xffff; }
-  //! Sets the 16 bits of spare storage in result/outcome.
-  template <class R, class S, class NoValuePolicy> constexpr inline void set_spare_storage(detail::basic_result_final<R, S, NoValuePolicy> *r, uint16_t v) noexcept { r->_state._status |= (v << detail::status_2byte_shift); }
+  //! Sets the 16 bits of spare storage in result/outcome, replacing any previous contents.
+  template <class R, class S, class NoValuePolicy> constexpr inline void set_spare_storage(detail::basic_result_final<R, S, NoValuePolicy> *r, uint16_t v) noexcept
+  {
+    r->_state._status = (r->_state._status & ~detail::status_2byte_mask) | (static_cast<detail::status_bitfield_type>(v) << detail::status_2byte_shift);
+  }
+
+  /*! A named range of `Bits` bits starting at bit `Offset` within the 16 bits of spare storage in result/outcome,
+  holding values of type `T`. `T` must be an integral or enumeration type.
+
+  Declare one of these per consumer of the spare storage, usually via `spare_storage_registry<...>::allocate<>`
+  so ranges never overlap.
+  */
+  template <unsigned Offset, unsigned Bits, class T = uint16_t> struct spare_storage_field
+  {
+    static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "Spare storage fields must be of integral or enumeration type");
+    static_assert(Bits > 0, "Spare storage fields must have at least one bit");
+    static_assert(Offset + Bits <= 16, "Spare storage fields must fit within the sixteen bits of spare storage");
+
+    //! The type of value stored in this field.
+    using value_type = T;
+    //! The first bit of spare storage used by this field.
+    static constexpr unsigned offset = Offset;
+    //! The number of bits of spare storage used by this field.
+    static constexpr unsigned bits = Bits;
+    //! The bits of spare storage used by this field.
+    static constexpr uint16_t mask = static_cast<uint16_t>(((1U << Bits) - 1) << Offset);
+  };
+  template <unsigned Offset, unsigned Bits, class T> constexpr unsigned spare_storage_field<Offset, Bits, T>::offset;
+  template <unsigned Offset, unsigned Bits, class T> constexpr unsigned spare_storage_field<Offset, Bits, T>::bits;
+  template <unsigned Offset, unsigned Bits, class T> constexpr uint16_t spare_storage_field<Offset, Bits, T>::mask;
+
+  /*! A compile time registry of the fields sharing the 16 bits of spare storage in result/outcome. Fails to
+  compile if any of `Fields` overlap.
+
+  Consumers of spare storage which know nothing of each other can be stacked by chaining registries:
+  ```
+  using tracing = hooks::spare_storage_registry<>::allocate<4>;
+  using registry1 = hooks::spare_storage_registry<tracing>;
+  using origin = registry1::allocate<8, origin_tag>;
+  using registry2 = registry1::add<origin>;
+  ```
+  */
+  template <class... Fields> struct spare_storage_registry
+  {
+    static_assert(detail::spare_storage_fields_disjoint({Fields::mask..., 0}), "Spare storage fields overlap");
+
+    //! The bits of spare storage used by all registered fields.
+    static constexpr uint16_t used = detail::spare_storage_fields_used({Fields::mask..., 0});
+    //! The bits of spare storage not used by any registered field.
+    static constexpr uint16_t available = static_cast<uint16_t>(~used);
+
+    //! A new field of `Bits` bits placed at the lowest offset not used by any registered field.
+    template <unsigned Bits, class T = uint16_t> using allocate = spare_storage_field<detail::spare_storage_first_fit(used, Bits), Bits, T>;
+    //! This registry with `Field` added.
+    template <class Field> using add = spare_storage_registry<Fields..., Field>;
+  };
+  template <class... Fields> constexpr uint16_t spare_storage_registry<Fields...>::used;
+  template <class... Fields> constexpr uint16_t spare_storage_registry<Fields...>::available;
+
+  //! Retrieves the value of a field of the spare storage in result/outcome.
+  template <class Field, class R, class S, class NoValuePolicy> constexpr inline typename Field::value_type spare_storage(const detail::basic_result_final<R, S, NoValuePolicy> *r) noexcept
+  {
+    return static_cast<typename Field::value_type>((spare_storage(r) & Field::mask) >> Field::offset);
+  }
+  /*! Sets the value of a field of the spare storage in result/outcome, replacing any previous value of
+  that field and leaving all other bits of spare storage untouched. Bits of `v` which do not fit into the
+  field are discarded.
+  */
+  template <class Field, class R, class S, class NoValuePolicy> constexpr inline void set_spare_storage(detail::basic_result_final<R, S, NoValuePolicy> *r, typename Field::value_type v) noexcept
+  {
+    set_spare_storage(r, static_cast<uint16_t>((spare_storage(r) & ~Field::mask) | ((static_cast<uint16_t>(v) << Field::offset) & Field::mask)));
+  }
+
+  /*! True if the state of result/outcome has been marked as observed. Observation is only recorded by
+  result/outcome whose destruction hook has been customised, for any other this is always false.
+  */
+  template <class R, class S, class NoValuePolicy> constexpr inline bool has_been_observed(const detail::basic_result_final<R, S, NoValuePolicy> *r) noexcept
+  {
+    const detail::observed_flag *observed = detail::observed_flag_of(r);
+    return observed != nullptr && observed->load();
+  }
+  /*! Marks the state of result/outcome as observed. Can be called on a `const` result/outcome, and from
+  several threads at once. Does nothing to result/outcome whose destruction hook has not been customised.
+  */
+  template <class R, class S, class NoValuePolicy> inline void mark_as_observed(const detail::basic_result_final<R, S, NoValuePolicy> *r) noexcept
+  {
+    detail::observed_flag *observed = detail::observed_flag_of(r);
+    if(observed != nullptr)
+    {
+      observed->store(true);
+    }
+  }
+  //! True if result/outcome has an error or exception, and its state has not been marked as observed.
+  template <class R, class S, class NoValuePolicy> constexpr inline bool has_unobserved_failure(const detail::basic_result_final<R, S, NoValuePolicy> *r) noexcept
+  {
+    return (r->_state._status & (detail::status_have_error | detail::status_have_exception)) != 0 && !has_been_observed(r);
+  }
+
+#ifdef OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING
+  /*! The count of failed results/outcomes destroyed without their state ever having been observed. Only
+  available if `OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING` is defined.
+  */
+  inline std::atomic<std::size_t> &unobserved_failures_destroyed() noexcept
+  {
+    static std::atomic<std::size_t> count(0);
+    return count;
+  }
+  /*! The default destruction hook implementation when `OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING` is defined.
+  Increments `unobserved_failures_destroyed()` if the result being destroyed has an unobserved failure.
+  \param 1 Some `result<...>` or `outcome<...>` being destroyed.
+  */
+  template <class T> inline void hook_result_destruction(T *r) noexcept
+  {
+    if(has_unobserved_failure(r))
+    {
+      unobserved_failures_destroyed().fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+#else
+  /*! The default destruction hook implementation called when a `result` or `outcome` is destroyed. Does nothing.
+  \param 1 Some `result<...>` or `outcome<...>` being destroyed.
+
+  If this hook is not customised for a given result/outcome, the result/outcome does not gain a destructor, and
+  so stays trivially destructible if its types are.
+  */
+  template <class T> constexpr inline detail::hook_result_destruction_not_customised hook_result_destruction(T * /*unused*/) noexcept { return {}; }
+#endif
+  /*! The default observation hook implementation called when the state of a `result` or `outcome` is observed
+  using `has_value()`, `has_error()`, `has_exception()`, `has_failure()`, the boolean test or a comparison
+  operator. Does nothing, unless `OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING` is defined, in which case it marks the
+  state as observed.
+  \param 1 Some `result<...>` or `outcome<...>` being observed.
+  */
+  template <class T> constexpr inline OUTCOME_DEBUG_INLINE void hook_result_state_observation(const T *r) noexcept
+  {
+#ifdef OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING
+    mark_as_observed(r);
+#else
+    (void) r;
+#endif
+  }
+  /*! The default observation hook implementation called when `value()` or `assume_value()` is called on
+  a `result` or `outcome`. Does nothing, unless `OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING` is defined, in which
+  case it marks the state as observed.
+  \param 1 Some `result<...>` or `outcome<...>` being observed.
+  */
+  template <class T> constexpr inline OUTCOME_DEBUG_INLINE void hook_result_value_observation(const T *r) noexcept
+  {
+#ifdef OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING
+    mark_as_observed(r);
+#else
+    (void) r;
+#endif
+  }
+  /*! The default observation hook implementation called when `error()` or `assume_error()` is called on
+  a `result` or `outcome`. Does nothing, unless `OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING` is defined, in which
+  case it marks the state as observed.
+  \param 1 Some `result<...>` or `outcome<...>` being observed.
+  */
+  template <class T> constexpr inline OUTCOME_DEBUG_INLINE void hook_result_error_observation(const T *r) noexcept
+  {
+#ifdef OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING
+    mark_as_observed(r);
+#else
+    (void) r;
+#endif
+  }
 }  // namespace hooks
 
 /*! Used to return from functions either (i) a successful value (ii) a cause of failure. `constexpr` capable.
@@ -244,19 +469,23 @@ protected:
     // Predicate for implicit constructors to be available at all
     static constexpr bool implicit_constructors_enabled = constructors_enabled && base::implicit_constructors_enabled;
 
-    //! Predicate for the value converting constructor to be available.
+    // Predicate for T to be considered by the value and error converting constructors at all
     template <class T>
-    static constexpr bool enable_value_converting_constructor =  //
-    constructors_enabled                                         //
-    && !std::is_same<std::decay_t<T>, basic_result>::value       // not my type
-    && base::template enable_value_converting_constructor<T>;
+    static constexpr bool converting_constructor_candidate =  //
+    constructors_enabled                                      //
+    && !std::is_same<std::decay_t<T>, basic_result>::value    // not my type
+    && base::template converting_constructor_candidate<T>;
+
+    //! Predicate for the value converting constructor to be available.
+    template <class T> static constexpr bool enable_value_converting_constructor = base::template converting_constructor<converting_constructor_candidate<T>, T>::value;
 
     //! Predicate for the error converting constructor to be available.
+    template <class T> static constexpr bool enable_error_converting_constructor = base::template converting_constructor<converting_constructor_candidate<T>, T>::error;
+
+    //! Predicate for the deleted constructor which reports that implicit construction is disabled to be available.
     template <class T>
-    static constexpr bool enable_error_converting_constructor =  //
-    constructors_enabled                                         //
-    && !std::is_same<std::decay_t<T>, basic_result>::value       // not my type
-    && base::template enable_error_converting_constructor<T>;
+    static constexpr bool enable_disabled_implicit_constructor =  //
+    base::template disabled_implicit_constructor<constructors_enabled && !implicit_constructors_enabled, T>::value;
 
     //! Predicate for the error condition converting constructor to be available.
     template <class ErrorCondEnum>
@@ -330,8 +559,7 @@ public:
   that `value_type` and `error_type` are ambiguous, whilst also preserving compile-time introspection.
   */
   OUTCOME_TEMPLATE(class T)
-  OUTCOME_TREQUIRES(OUTCOME_TPRED((predicate::constructors_enabled && !predicate::implicit_constructors_enabled  //
-                                   && (detail::is_implicitly_constructible<value_type, T> || detail::is_implicitly_constructible<error_type, T>) )))
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_disabled_implicit_constructor<T>))
   basic_result(T && /*unused*/, implicit_constructors_disabled_tag /*unused*/ = implicit_constructors_disabled_tag()) = delete;  // NOLINT Implicit constructors disabled, use explicit in_place_type<T>, success() or failure(). see docs!
 
   /// \output_section Converting constructors
@@ -390,8 +618,8 @@ public:
   \throws Any exception the construction of `error_type(make_error_code(t))` might throw.
   */
   OUTCOME_TEMPLATE(class ErrorCondEnum)
-  OUTCOME_TREQUIRES(OUTCOME_TEXPR(error_type(make_error_code(ErrorCondEnum()))),  //
-                    OUTCOME_TPRED(predicate::template enable_error_condition_converting_constructor<ErrorCondEnum>))
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_error_condition_converting_constructor<ErrorCondEnum>),  // checked first to save the lookup below
+                    OUTCOME_TEXPR(error_type(make_error_code(ErrorCondEnum()))))
   constexpr basic_result(ErrorCondEnum &&t, error_condition_converting_constructor_tag /*unused*/ = error_condition_converting_constructor_tag()) noexcept(noexcept(error_type(make_error_code(static_cast<ErrorCondEnum &&>(t)))))  // NOLINT
   : base{in_place_type<typename base::error_type>, make_error_code(t)}
   {
@@ -676,7 +904,7 @@ template <class R, class S, class P> inline void swap(basic_result<R, S, P> &a,
   a.swap(b);
 }
 
-#if !defined(NDEBUG)
+#if !defined(NDEBUG) && !defined(OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING)
 // Check is trivial in all ways except default constructibility
 // static_assert(std::is_trivial<basic_result<int, long, policy::all_narrow>>::value, "result<int> is not trivial!");
 // static_assert(std::is_trivially_default_constructible<basic_result<int, long, policy::all_narrow>>::value, "result<int> is not trivially default constructible!");
@@ -0,0 +1,402 @@
+/* Memory mapped logs of binary serialised results and outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_BINARY_LOG_HPP
+#define OUTCOME_BINARY_LOG_HPP
+
+#include "binary_support.hpp"
+
+#include <cerrno>
+#include <iterator>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifndef OUTCOME_BINARY_LOG_INDEX_STRIDE
+//! The number of records between entries of the sparse index `binary_log_reader` builds to seek.
+#define OUTCOME_BINARY_LOG_INDEX_STRIDE 1024
+#endif
+#ifndef OUTCOME_BINARY_LOG_PREFETCH_DISTANCE
+//! How many bytes ahead of the current record `binary_log_reader` prefetches.
+#define OUTCOME_BINARY_LOG_PREFETCH_DISTANCE 512
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+/*! Binary log records are a `uint32` little endian byte count followed by the record
+written by `binary_encode()`, so a reader can step over records without decoding them.
+A binary log is a sequence of such records, for example a file of them appended one after another.
+*/
+OUTCOME_INLINE_CONSTEXPR size_t binary_log_frame_size = 4;
+
+//! Returns the number of bytes `binary_log_encode()` writes for `v`.
+template <class Impl> inline auto binary_log_size(const Impl &v) noexcept -> decltype(binary_size(v)) { return binary_log_frame_size + binary_size(v); }
+
+/*! Binary serialise `v` as a binary log record.
+\returns The number of bytes written, or any failure from `binary_encode()`.
+*/
+template <class Impl> inline auto binary_log_encode(unsigned char *buffer, size_t length, const Impl &v) noexcept -> decltype(binary_encode(buffer, length, v))
+{
+  if(length < binary_log_frame_size)
+  {
+    return std::errc::no_buffer_space;
+  }
+  auto r = binary_encode(buffer + binary_log_frame_size, length - binary_log_frame_size, v);
+  if(!r)
+  {
+    return r;
+  }
+  const size_t bytes = r.value();
+  if(bytes > 0xffffffffU)
+  {
+    return std::errc::value_too_large;
+  }
+  detail::binary_store_le<uint32_t>(buffer, static_cast<uint32_t>(bytes));
+  return binary_log_frame_size + bytes;
+}
+
+/*! A read only mapping of a whole file into memory, for reading binary logs without copying them.
+Mappings are move only, and unmap the file on destruction.
+*/
+class binary_log_mapping
+{
+  const unsigned char *_data{nullptr};
+  size_t _size{0};
+
+  binary_log_mapping(const unsigned char *data, size_t size) noexcept
+      : _data(data)
+      , _size(size)
+  {
+  }
+  void _unmap() noexcept
+  {
+    if(_data != nullptr)
+    {
+#ifdef _WIN32
+      UnmapViewOfFile(_data);
+#else
+      munmap(const_cast<unsigned char *>(_data), _size);  // NOLINT
+#endif
+      _data = nullptr;
+      _size = 0;
+    }
+  }
+
+public:
+  //! An empty mapping.
+  binary_log_mapping() = default;
+  binary_log_mapping(const binary_log_mapping &) = delete;
+  binary_log_mapping(binary_log_mapping &&o) noexcept
+      : _data(o._data)
+      , _size(o._size)
+  {
+    o._data = nullptr;
+    o._size = 0;
+  }
+  binary_log_mapping &operator=(const binary_log_mapping &) = delete;
+  binary_log_mapping &operator=(binary_log_mapping &&o) noexcept
+  {
+    if(this != &o)
+    {
+      _unmap();
+      _data = o._data;
+      _size = o._size;
+      o._data = nullptr;
+      o._size = 0;
+    }
+    return *this;
+  }
+  ~binary_log_mapping() { _unmap(); }
+
+  /*! Maps the whole of the file at `path` read only, advising the system it will be read sequentially.
+  \returns The mapping, or the error from the system. Empty files give an empty mapping.
+  */
+  static result<binary_log_mapping> map(const char *path) noexcept
+  {
+#ifdef _WIN32
+    HANDLE h = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if(h == INVALID_HANDLE_VALUE)  // NOLINT
+    {
+      return std::error_code(static_cast<int>(GetLastError()), std::system_category());
+    }
+    LARGE_INTEGER size;
+    if(GetFileSizeEx(h, &size) == 0)
+    {
+      const std::error_code ec(static_cast<int>(GetLastError()), std::system_category());
+      CloseHandle(h);
+      return ec;
+    }
+    if(size.QuadPart == 0)
+    {
+      CloseHandle(h);
+      return binary_log_mapping();
+    }
+    HANDLE m = CreateFileMappingA(h, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(h);
+    if(m == nullptr)
+    {
+      return std::error_code(static_cast<int>(GetLastError()), std::system_category());
+    }
+    void *p = MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+    const std::error_code ec(static_cast<int>(GetLastError()), std::system_category());
+    CloseHandle(m);
+    if(p == nullptr)
+    {
+      return ec;
+    }
+    return binary_log_mapping(static_cast<const unsigned char *>(p), static_cast<size_t>(size.QuadPart));
+#else
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);  // NOLINT
+    if(fd == -1)
+    {
+      return std::error_code(errno, std::generic_category());
+    }
+    struct stat s
+    {
+    };
+    if(::fstat(fd, &s) == -1)
+    {
+      const std::error_code ec(errno, std::generic_category());
+      ::close(fd);
+      return ec;
+    }
+    if(s.st_size == 0)
+    {
+      ::close(fd);
+      return binary_log_mapping();
+    }
+    void *p = ::mmap(nullptr, static_cast<size_t>(s.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    const std::error_code ec(errno, std::generic_category());
+    ::close(fd);
+    if(p == MAP_FAILED)  // NOLINT
+    {
+      return ec;
+    }
+    ::madvise(p, static_cast<size_t>(s.st_size), MADV_SEQUENTIAL);
+    return binary_log_mapping(static_cast<const unsigned char *>(p), static_cast<size_t>(s.st_size));
+#endif
+  }
+
+  //! The mapped bytes.
+  const unsigned char *data() const noexcept { return _data; }
+  //! The number of mapped bytes.
+  size_t size() const noexcept { return _size; }
+};
+
+/*! A view of one record of a binary log, which is only decoded when asked. Valid for as long as
+the bytes of the log are.
+*/
+class binary_log_record
+{
+  const unsigned char *_data{nullptr};
+  size_t _size{0};
+
+public:
+  binary_log_record() = default;
+  //! Views the `size` bytes of the record written by `binary_encode()` at `data`.
+  constexpr binary_log_record(const unsigned char *data, size_t size) noexcept
+      : _data(data)
+      , _size(size)
+  {
+  }
+
+  //! The bytes written by `binary_encode()`.
+  constexpr const unsigned char *data() const noexcept { return _data; }
+  //! The number of bytes written by `binary_encode()`.
+  constexpr size_t size() const noexcept { return _size; }
+
+  //! The status bits stored in the record, or zero if it is too short to have any.
+  uint32_t status() const noexcept { return (_size < detail::binary_header_size) ? 0 : detail::binary_load_le<uint32_t>(_data + 1); }
+  //! True if the record stores a value.
+  bool has_value() const noexcept { return (status() & detail::status_have_value) != 0; }
+  //! True if the record stores an error.
+  bool has_error() const noexcept { return (status() & detail::status_have_error) != 0; }
+  //! True if the record stores an exception.
+  bool has_exception() const noexcept { return (status() & detail::status_have_exception) != 0; }
+
+  /*! Decodes the record into `v`, which may be reused across records to avoid constructing one per record.
+  \returns Any failure from `binary_decode()`, including if the record was not all consumed.
+  */
+  template <class Impl> auto decode(Impl &v) const -> decltype(binary_decode(_data, _size, v))
+  {
+    auto r = binary_decode(_data, _size, v);
+    if(r && r.value() != _size)
+    {
+      return std::errc::illegal_byte_sequence;
+    }
+    return r;
+  }
+};
+
+/*! Lazily walks the records of a binary log in memory, typically a `binary_log_mapping`.
+Walking does not allocate nor decode; records are decoded only when asked.
+
+Seeking to a record number uses a sparse index of every `OUTCOME_BINARY_LOG_INDEX_STRIDE`th
+record, built as far as needed on first use, so a seek walks at most that many records. A record
+whose byte count overruns the log, such as a partially written final record, ends the log.
+*/
+class binary_log_reader
+{
+  const unsigned char *_begin{nullptr}, *_end{nullptr};
+  // Offset of every OUTCOME_BINARY_LOG_INDEX_STRIDE'th record before _indexed_to
+  std::vector<size_t> _index;
+  const unsigned char *_indexed_to{nullptr};
+  size_t _indexed_records{0};
+
+  // The record after the one at p, or null if the one at p is incomplete
+  static const unsigned char *_next(const unsigned char *p, const unsigned char *end) noexcept
+  {
+    if(static_cast<size_t>(end - p) < binary_log_frame_size)
+    {
+      return nullptr;
+    }
+    const uint32_t bytes = detail::binary_load_le<uint32_t>(p);
+    if(static_cast<size_t>(end - p) - binary_log_frame_size < bytes)
+    {
+      return nullptr;
+    }
+    return p + binary_log_frame_size + bytes;
+  }
+
+public:
+  //! Forward iterator over the records of a binary log.
+  class iterator
+  {
+    friend class binary_log_reader;
+    const unsigned char *_p{nullptr}, *_end{nullptr};
+
+    constexpr iterator(const unsigned char *p, const unsigned char *end) noexcept
+        : _p(p)
+        , _end(end)
+    {
+    }
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = binary_log_record;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const binary_log_record *;
+    using reference = binary_log_record;
+
+    constexpr iterator() = default;
+    binary_log_record operator*() const noexcept { return {_p + binary_log_frame_size, detail::binary_load_le<uint32_t>(_p)}; }
+    iterator &operator++() noexcept
+    {
+      _p += binary_log_frame_size + detail::binary_load_le<uint32_t>(_p);
+      if(_next(_p, _end) == nullptr)
+      {
+        // Finished, or the rest is torn
+        _p = _end;
+      }
+#if defined(__GNUC__) || defined(__clang__)
+      else if(static_cast<size_t>(_end - _p) > OUTCOME_BINARY_LOG_PREFETCH_DISTANCE)
+      {
+        __builtin_prefetch(_p + OUTCOME_BINARY_LOG_PREFETCH_DISTANCE);
+      }
+#endif
+      return *this;
+    }
+    iterator operator++(int) noexcept
+    {
+      iterator ret(*this);
+      ++*this;
+      return ret;
+    }
+    constexpr bool operator==(const iterator &o) const noexcept { return _p == o._p; }
+    constexpr bool operator!=(const iterator &o) const noexcept { return _p != o._p; }
+  };
+
+  binary_log_reader() = default;
+  //! Reads the binary log in the `size` bytes at `data`.
+  binary_log_reader(const unsigned char *data, size_t size)
+      : _begin(data)
+      , _end(data + size)
+      , _indexed_to(data)
+  {
+    // A torn first record makes the log empty
+    if(_next(_begin, _end) == nullptr)
+    {
+      _end = _begin;
+    }
+  }
+  //! Reads the binary log in a mapping, which must outlive the reader.
+  explicit binary_log_reader(const binary_log_mapping &m)
+      : binary_log_reader(m.data(), m.size())
+  {
+  }
+
+  //! An iterator to the first record.
+  iterator begin() const noexcept { return {_begin, _end}; }
+  //! An iterator past the last complete record.
+  iterator end() const noexcept { return {_end, _end}; }
+
+  /*! Returns an iterator to record number `n`, counting from zero, or `end()` if there are not that many.
+  \throws `std::bad_alloc` if the index could not be extended.
+  */
+  iterator seek(size_t n)
+  {
+    const size_t stride = OUTCOME_BINARY_LOG_INDEX_STRIDE;
+    // Extend the index until it covers record n, or the log runs out
+    while(_indexed_to != _end && _indexed_records <= n)
+    {
+      if(_indexed_records % stride == 0)
+      {
+        _index.push_back(static_cast<size_t>(_indexed_to - _begin));
+      }
+      _indexed_to = _next(_indexed_to, _end);
+      if(_next(_indexed_to, _end) == nullptr)
+      {
+        _indexed_to = _end;
+      }
+      ++_indexed_records;
+    }
+    if(n >= _indexed_records)
+    {
+      return end();
+    }
+    iterator it(_begin + _index[n / stride], _end);
+    for(size_t i = n / stride * stride; i < n; i++)
+    {
+      ++it;
+    }
+    return it;
+  }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,619 @@
+/* Binary serialisation for result and outcome
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_BINARY_SUPPORT_HPP
+#define OUTCOME_BINARY_SUPPORT_HPP
+
+#include "outcome.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <ios>
+#include <limits>
+#include <string>
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+/*! The version of the layout written by `binary_encode()`, stored as the first byte of every record.
+
+Version 1 records are, with all integers little endian:
+
+1. `uint8` format version.
+2. `uint32` status bits. Spare storage is preserved.
+3. The value if the status says there is one, using `binary_serialiser<T>`.
+4. The error if the status says there is one, using `binary_serialiser<EC>`.
+5. For outcome only, the exception if the status says there is one, using `binary_serialiser<EP>`.
+
+`void` values and errors take no bytes.
+
+Results are encoded field by field, never by copying the whole object with `memcpy`, even
+when trivially copyable. The object's layout, padding and status word are those of the host
+and the build, and `std::error_code` holds a category pointer, so a copy of the object could
+only be read back by the same build on the same host. Values of trivially copyable types are
+still copied by `memcpy`, see `binary_serialiser`.
+*/
+OUTCOME_INLINE_CONSTEXPR uint8_t binary_format_version = 1;
+
+namespace detail
+{
+  // Byte at a time so the layout is independent of host endian. Compilers reduce these to a plain load or store on little endian hosts.
+  template <class T> inline void binary_store_le(unsigned char *out, T v) noexcept
+  {
+    using U = std::make_unsigned_t<T>;
+    auto u = static_cast<U>(v);
+    for(size_t n = 0; n < sizeof(T); n++)
+    {
+      out[n] = static_cast<unsigned char>(u >> (8 * n));  // NOLINT
+    }
+  }
+  template <class T> inline T binary_load_le(const unsigned char *in) noexcept
+  {
+    using U = std::make_unsigned_t<T>;
+    U u = 0;
+    for(size_t n = 0; n < sizeof(T); n++)
+    {
+      u = static_cast<U>(u | (static_cast<U>(in[n]) << (8 * n)));  // NOLINT
+    }
+    return static_cast<T>(u);
+  }
+  template <size_t Bytes> struct binary_unsigned_of_size;
+  template <> struct binary_unsigned_of_size<1>
+  {
+    using type = uint8_t;
+  };
+  template <> struct binary_unsigned_of_size<2>
+  {
+    using type = uint16_t;
+  };
+  template <> struct binary_unsigned_of_size<4>
+  {
+    using type = uint32_t;
+  };
+  template <> struct binary_unsigned_of_size<8>
+  {
+    using type = uint64_t;
+  };
+}  // namespace detail
+
+/*! Customisation point for the binary encoding of a value, error or exception type `T`.
+Specialise it for your own types, providing:
+
+- `static size_t size(const T &v) noexcept` returning the bytes `encode()` will write.
+- `static unsigned char *encode(unsigned char *out, const T &v) noexcept` writing exactly
+`size(v)` bytes and returning `out + size(v)`, or `nullptr` if `v` cannot be encoded.
+- `static const unsigned char *decode(const unsigned char *in, size_t len, T &v)` reading
+from at most `len` bytes into a default constructed `v`, and returning one past the last byte
+read, or `nullptr` if the bytes are malformed or truncated.
+
+Outcome provides specialisations for integral, enumeration and IEEE floating point types
+(little endian), other trivially copyable types (the host representation, by `memcpy`),
+`std::string` and `std::error_code` (see `register_binary_error_category()`).
+*/
+template <class T, class Enable = void> struct binary_serialiser
+{
+};
+
+namespace detail
+{
+  template <class T, class = void> struct is_binary_serialisable : std::false_type
+  {
+  };
+  template <class T> struct is_binary_serialisable<T, std::enable_if_t<std::is_same<decltype(binary_serialiser<T>::size(std::declval<const T &>())), size_t>::value>> : std::true_type
+  {
+  };
+  // void values and errors are stored as void_type, which take no bytes
+  template <> struct is_binary_serialisable<void_type> : std::true_type
+  {
+  };
+}  // namespace detail
+
+template <> struct binary_serialiser<detail::void_type>
+{
+  static size_t size(const detail::void_type & /*unused*/) noexcept { return 0; }
+  static unsigned char *encode(unsigned char *out, const detail::void_type & /*unused*/) noexcept { return out; }
+  static const unsigned char *decode(const unsigned char *in, size_t /*unused*/, detail::void_type & /*unused*/) noexcept { return in; }
+};
+
+//! Integral and enumeration types are written little endian in their own size.
+template <class T> struct binary_serialiser<T, std::enable_if_t<std::is_integral<T>::value || std::is_enum<T>::value>>
+{
+  using _int_type = typename detail::binary_unsigned_of_size<sizeof(T)>::type;
+  static size_t size(const T & /*unused*/) noexcept { return sizeof(T); }
+  static unsigned char *encode(unsigned char *out, const T &v) noexcept
+  {
+    detail::binary_store_le<_int_type>(out, static_cast<_int_type>(v));
+    return out + sizeof(T);
+  }
+  static const unsigned char *decode(const unsigned char *in, size_t len, T &v) noexcept
+  {
+    if(len < sizeof(T))
+    {
+      return nullptr;
+    }
+    v = static_cast<T>(detail::binary_load_le<_int_type>(in));
+    return in + sizeof(T);
+  }
+};
+
+//! IEEE floating point types are written as their bit pattern, little endian.
+template <class T> struct binary_serialiser<T, std::enable_if_t<std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8)>>
+{
+  using _int_type = typename detail::binary_unsigned_of_size<sizeof(T)>::type;
+  static size_t size(const T & /*unused*/) noexcept { return sizeof(T); }
+  static unsigned char *encode(unsigned char *out, const T &v) noexcept
+  {
+    _int_type bits;
+    std::memcpy(&bits, &v, sizeof(T));
+    detail::binary_store_le<_int_type>(out, bits);
+    return out + sizeof(T);
+  }
+  static const unsigned char *decode(const unsigned char *in, size_t len, T &v) noexcept
+  {
+    if(len < sizeof(T))
+    {
+      return nullptr;
+    }
+    const auto bits = detail::binary_load_le<_int_type>(in);
+    std::memcpy(&v, &bits, sizeof(T));
+    return in + sizeof(T);
+  }
+};
+
+/*! Any other trivially copyable type is copied by `memcpy` in the host representation, so
+is only portable between builds agreeing on its layout and endian. Specialise `binary_serialiser`
+for such types if that is not acceptable.
+*/
+template <class T> struct binary_serialiser<T, std::enable_if_t<std::is_trivially_copyable<T>::value && std::is_class<T>::value && !std::is_same<T, detail::void_type>::value>>
+{
+  static size_t size(const T & /*unused*/) noexcept { return sizeof(T); }
+  static unsigned char *encode(unsigned char *out, const T &v) noexcept
+  {
+    std::memcpy(out, &v, sizeof(T));
+    return out + sizeof(T);
+  }
+  static const unsigned char *decode(const unsigned char *in, size_t len, T &v) noexcept
+  {
+    if(len < sizeof(T))
+    {
+      return nullptr;
+    }
+    std::memcpy(&v, in, sizeof(T));
+    return in + sizeof(T);
+  }
+};
+
+//! Strings are a `uint32` byte count followed by the bytes.
+template <> struct binary_serialiser<std::string>
+{
+  static size_t size(const std::string &v) noexcept { return 4 + v.size(); }
+  static unsigned char *encode(unsigned char *out, const std::string &v) noexcept
+  {
+    if(v.size() > 0xffffffffU)
+    {
+      return nullptr;
+    }
+    detail::binary_store_le<uint32_t>(out, static_cast<uint32_t>(v.size()));
+    std::memcpy(out + 4, v.data(), v.size());
+    return out + 4 + v.size();
+  }
+  static const unsigned char *decode(const unsigned char *in, size_t len, std::string &v)
+  {
+    if(len < 4)
+    {
+      return nullptr;
+    }
+    const uint32_t n = detail::binary_load_le<uint32_t>(in);
+    if(len - 4 < n)
+    {
+      return nullptr;
+    }
+    v.assign(reinterpret_cast<const char *>(in + 4), n);  // NOLINT
+    return in + 4 + n;
+  }
+};
+
+namespace detail
+{
+  struct binary_error_category_mapping
+  {
+    const binary_error_category_mapping *next;
+    const std::error_category *category;
+    uint32_t id;
+  };
+  // User registered categories, most recently registered first. Nodes are never freed.
+  inline std::atomic<const binary_error_category_mapping *> &binary_error_category_mappings() noexcept
+  {
+    static std::atomic<const binary_error_category_mapping *> v{nullptr};
+    return v;
+  }
+  // The STL categories, whose ids are fixed forever
+  inline const binary_error_category_mapping *binary_error_category_stl_mappings() noexcept
+  {
+    static const binary_error_category_mapping v[] = {
+    {nullptr, &std::generic_category(), 1},   //
+    {nullptr, &std::system_category(), 2},    //
+    {nullptr, &std::iostream_category(), 3},  //
+    {nullptr, nullptr, 0}                     //
+    };
+    return v;
+  }
+}  // namespace detail
+
+/*! Registers a stable id for an error category, so `std::error_code`s of that category can
+be binary encoded. The id is written in place of the category, so must mean the same category
+to every program reading the encoding.
+\param category The category to register.
+\param id The id to give it. Ids below 256 are reserved for Outcome, and 0 is never valid.
+
+\effects Outcome preregisters `generic_category()` as 1, `system_category()` as 2 and
+`iostream_category()` as 3. `future_category()` is not preregistered so as not to need
+`<future>`, so register it with an id of your own if you need it. Registration is thread
+safe, and registrations cannot be removed.
+\returns `errc::invalid_argument` if `id` is reserved, or if `category` or `id` is already
+registered, as either would make error codes decode as the wrong category.
+\throws `std::bad_alloc` if the registration could not be allocated.
+*/
+inline result<void> register_binary_error_category(const std::error_category &category, uint32_t id)
+{
+  if(id < 256)
+  {
+    return std::errc::invalid_argument;
+  }
+  for(const detail::binary_error_category_mapping *m = detail::binary_error_category_stl_mappings(); m->category != nullptr; ++m)
+  {
+    if(*m->category == category)
+    {
+      return std::errc::invalid_argument;
+    }
+  }
+  auto *m = new detail::binary_error_category_mapping{nullptr, &category, id};
+  auto &head = detail::binary_error_category_mappings();
+  const detail::binary_error_category_mapping *expected = head.load(std::memory_order_acquire);
+  do
+  {
+    // Rechecked after every lost race, so two threads cannot register the same category or id
+    for(const detail::binary_error_category_mapping *i = expected; i != nullptr; i = i->next)
+    {
+      if(*i->category == category || i->id == id)
+      {
+        delete m;
+        return std::errc::invalid_argument;
+      }
+    }
+    m->next = expected;
+  } while(!head.compare_exchange_weak(expected, m, std::memory_order_release, std::memory_order_acquire));
+  return success();
+}
+
+//! Returns the id registered for `category`, or zero if it has none.
+inline uint32_t binary_error_category_id(const std::error_category &category) noexcept
+{
+  for(const detail::binary_error_category_mapping *m = detail::binary_error_category_stl_mappings(); m->category != nullptr; ++m)
+  {
+    if(*m->category == category)
+    {
+      return m->id;
+    }
+  }
+  for(const detail::binary_error_category_mapping *m = detail::binary_error_category_mappings().load(std::memory_order_acquire); m != nullptr; m = m->next)
+  {
+    if(*m->category == category)
+    {
+      return m->id;
+    }
+  }
+  return 0;
+}
+
+//! Returns the category registered as `id`, or null if there is none.
+inline const std::error_category *binary_error_category(uint32_t id) noexcept
+{
+  for(const detail::binary_error_category_mapping *m = detail::binary_error_category_stl_mappings(); m->category != nullptr; ++m)
+  {
+    if(m->id == id)
+    {
+      return m->category;
+    }
+  }
+  for(const detail::binary_error_category_mapping *m = detail::binary_error_category_mappings().load(std::memory_order_acquire); m != nullptr; m = m->next)
+  {
+    if(m->id == id)
+    {
+      return m->category;
+    }
+  }
+  return nullptr;
+}
+
+/*! Error codes are a `uint32` category id followed by the `int32` value. Error codes whose
+category has no id registered with `register_binary_error_category()` cannot be encoded.
+A default constructed error code, as found in a valued result, is encoded as category
+id zero and value zero.
+*/
+template <> struct binary_serialiser<std::error_code>
+{
+  static size_t size(const std::error_code & /*unused*/) noexcept { return 8; }
+  static unsigned char *encode(unsigned char *out, const std::error_code &v) noexcept
+  {
+    uint32_t id = 0;
+    if(v)
+    {
+      id = binary_error_category_id(v.category());
+      if(id == 0)
+      {
+        return nullptr;
+      }
+    }
+    detail::binary_store_le<uint32_t>(out, id);
+    detail::binary_store_le<int32_t>(out + 4, v.value());
+    return out + 8;
+  }
+  static const unsigned char *decode(const unsigned char *in, size_t len, std::error_code &v) noexcept
+  {
+    if(len < 8)
+    {
+      return nullptr;
+    }
+    const uint32_t id = detail::binary_load_le<uint32_t>(in);
+    const int32_t value = detail::binary_load_le<int32_t>(in + 4);
+    if(id == 0)
+    {
+      if(value != 0)
+      {
+        return nullptr;
+      }
+      v = std::error_code();
+      return in + 8;
+    }
+    const std::error_category *category = binary_error_category(id);
+    if(category == nullptr)
+    {
+      return nullptr;
+    }
+    v = std::error_code(value, *category);
+    return in + 8;
+  }
+};
+
+namespace detail
+{
+  OUTCOME_INLINE_CONSTEXPR size_t binary_header_size = 5;
+
+  // Accesses the error or exception of a result or outcome, giving void_type where those are void. Only call when present.
+  template <class Impl> inline const auto &binary_error(const Impl &v, std::false_type /*void*/) noexcept { return v.assume_error(); }
+  template <class Impl> inline auto &binary_error(Impl &v, std::false_type /*void*/) noexcept { return v.assume_error(); }
+  template <class Impl> inline void_type binary_error(const Impl & /*unused*/, std::true_type /*void*/) noexcept { return {}; }
+  template <class Impl> inline const auto &binary_exception(const Impl &v, std::false_type /*void*/) noexcept { return v.assume_exception(); }
+  template <class Impl> inline auto &binary_exception(Impl &v, std::false_type /*void*/) noexcept { return v.assume_exception(); }
+  template <class Impl> inline void_type binary_exception(const Impl & /*unused*/, std::true_type /*void*/) noexcept { return {}; }
+
+  template <class T> inline unsigned char *binary_field_encode(unsigned char *out, bool present, const T &v) noexcept { return (out != nullptr && present) ? binary_serialiser<T>::encode(out, v) : out; }
+  template <class T> inline const unsigned char *binary_field_decode(const unsigned char *in, const unsigned char *end, bool present, T &v) { return (in != nullptr && present) ? binary_serialiser<T>::decode(in, static_cast<size_t>(end - in), v) : in; }
+
+  template <class State> inline unsigned char *binary_encode_header(unsigned char *out, const State &state) noexcept
+  {
+    out[0] = binary_format_version;
+    binary_store_le<uint32_t>(out + 1, state._status);
+    return out + binary_header_size;
+  }
+  inline const unsigned char *binary_decode_header(const unsigned char *in, size_t len, status_bitfield_type &status, std::error_code &ec) noexcept
+  {
+    if(len < binary_header_size)
+    {
+      ec = std::make_error_code(std::errc::illegal_byte_sequence);
+      return nullptr;
+    }
+    if(in[0] != binary_format_version)
+    {
+      ec = std::make_error_code(std::errc::protocol_not_supported);
+      return nullptr;
+    }
+    status = binary_load_le<uint32_t>(in + 1);
+    return in + binary_header_size;
+  }
+}  // namespace detail
+
+/*! Returns the number of bytes `binary_encode()` writes for a result.
+\requires That `R` and `S` are void or have a `binary_serialiser`.
+*/
+OUTCOME_TEMPLATE(class R, class S, class P)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_binary_serialisable<detail::devoid<R>>::value &&detail::is_binary_serialisable<detail::devoid<S>>::value))
+inline size_t binary_size(const basic_result<R, S, P> &v) noexcept
+{
+  const auto &state = v._iostreams_state();
+  return detail::binary_header_size + (v.has_value() ? binary_serialiser<detail::devoid<R>>::size(state._value) : 0)  //
+         + (v.has_error() ? binary_serialiser<detail::devoid<S>>::size(detail::binary_error(v, std::is_void<S>())) : 0);
+}
+/*! Binary serialise a result in the layout described by `binary_format_version`.
+\returns The number of bytes written, `errc::no_buffer_space` if `length` is less than `binary_size(v)`,
+or `errc::not_supported` if a serialiser could not encode its part. The contents of the buffer
+are unspecified after a failure.
+\requires That `R` and `S` are void or have a `binary_serialiser`.
+*/
+OUTCOME_TEMPLATE(class R, class S, class P)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_binary_serialisable<detail::devoid<R>>::value &&detail::is_binary_serialisable<detail::devoid<S>>::value))
+inline result<size_t> binary_encode(unsigned char *buffer, size_t length, const basic_result<R, S, P> &v) noexcept
+{
+  const size_t bytes = binary_size(v);
+  if(length < bytes)
+  {
+    return std::errc::no_buffer_space;
+  }
+  const auto &state = v._iostreams_state();
+  unsigned char *out = detail::binary_encode_header(buffer, state);
+  out = detail::binary_field_encode(out, v.has_value(), state._value);
+  if(v.has_error())
+  {
+    out = detail::binary_field_encode(out, true, detail::binary_error(v, std::is_void<S>()));
+  }
+  if(out == nullptr)
+  {
+    return std::errc::not_supported;
+  }
+  return bytes;
+}
+/*! Binary deserialise a result written by `binary_encode()`. Spare storage is preserved.
+\returns The number of bytes read, `errc::protocol_not_supported` if written by an unknown
+format version, or `errc::illegal_byte_sequence` if truncated or malformed, including a status
+which `v` could not have. `v` is unchanged after a failure.
+\requires That `R` and `S` are void, or default constructible and have a `binary_serialiser`.
+*/
+OUTCOME_TEMPLATE(class R, class S, class P)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_binary_serialisable<detail::devoid<R>>::value &&detail::is_binary_serialisable<detail::devoid<S>>::value))
+inline result<size_t> binary_decode(const unsigned char *buffer, size_t length, basic_result<R, S, P> &v)
+{
+  const unsigned char *end = buffer + length;
+  detail::status_bitfield_type status = 0;
+  std::error_code ec;
+  const unsigned char *in = detail::binary_decode_header(buffer, length, status, ec);
+  if(in == nullptr)
+  {
+    return ec;
+  }
+  if(!detail::status_is_valid(status, false))
+  {
+    return std::errc::illegal_byte_sequence;
+  }
+  // Decode into temporaries first so v is untouched by malformed input
+  detail::devoid<R> value{};
+  detail::devoid<S> error{};
+  in = detail::binary_field_decode(in, end, (status & detail::status_have_value) != 0, value);
+  in = detail::binary_field_decode(in, end, (status & detail::status_have_error) != 0, error);
+  if(in == nullptr)
+  {
+    return std::errc::illegal_byte_sequence;
+  }
+  auto &state = v._iostreams_state();
+  state = std::decay_t<decltype(state)>();
+  state._status = status;
+  if((status & detail::status_have_value) != 0)
+  {
+    new(&state._value) detail::devoid<R>(std::move(value));  // NOLINT
+  }
+  if((status & detail::status_have_error) != 0)
+  {
+    detail::binary_error(v, std::is_void<S>()) = std::move(error);
+  }
+  return static_cast<size_t>(in - buffer);
+}
+
+/*! Returns the number of bytes `binary_encode()` writes for an outcome.
+\requires That `R`, `S` and `P` are void or have a `binary_serialiser`.
+*/
+OUTCOME_TEMPLATE(class R, class S, class P, class N)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_binary_serialisable<detail::devoid<R>>::value &&detail::is_binary_serialisable<detail::devoid<S>>::value &&detail::is_binary_serialisable<detail::devoid<P>>::value))
+inline size_t binary_size(const basic_outcome<R, S, P, N> &v) noexcept
+{
+  const auto &state = v._iostreams_state();
+  return detail::binary_header_size + (v.has_value() ? binary_serialiser<detail::devoid<R>>::size(state._value) : 0)  //
+         + (v.has_error() ? binary_serialiser<detail::devoid<S>>::size(detail::binary_error(v, std::is_void<S>())) : 0)        //
+         + (v.has_exception() ? binary_serialiser<detail::devoid<P>>::size(detail::binary_exception(v, std::is_void<P>())) : 0);
+}
+/*! Binary serialise an outcome in the layout described by `binary_format_version`.
+\returns The number of bytes written, `errc::no_buffer_space` if `length` is less than `binary_size(v)`,
+or `errc::not_supported` if a serialiser could not encode its part. The contents of the buffer
+are unspecified after a failure.
+\requires That `R`, `S` and `P` are void or have a `binary_serialiser`. There is none for
+`std::exception_ptr`, so outcomes with the default exception type cannot be binary serialised.
+*/
+OUTCOME_TEMPLATE(class R, class S, class P, class N)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_binary_serialisable<detail::devoid<R>>::value &&detail::is_binary_serialisable<detail::devoid<S>>::value &&detail::is_binary_serialisable<detail::devoid<P>>::value))
+inline result<size_t> binary_encode(unsigned char *buffer, size_t length, const basic_outcome<R, S, P, N> &v) noexcept
+{
+  const size_t bytes = binary_size(v);
+  if(length < bytes)
+  {
+    return std::errc::no_buffer_space;
+  }
+  const auto &state = v._iostreams_state();
+  unsigned char *out = detail::binary_encode_header(buffer, state);
+  out = detail::binary_field_encode(out, v.has_value(), state._value);
+  if(v.has_error())
+  {
+    out = detail::binary_field_encode(out, true, detail::binary_error(v, std::is_void<S>()));
+  }
+  if(v.has_exception())
+  {
+    out = detail::binary_field_encode(out, true, detail::binary_exception(v, std::is_void<P>()));
+  }
+  if(out == nullptr)
+  {
+    return std::errc::not_supported;
+  }
+  return bytes;
+}
+/*! Binary deserialise an outcome written by `binary_encode()`. Spare storage is preserved.
+\returns The number of bytes read, `errc::protocol_not_supported` if written by an unknown
+format version, or `errc::illegal_byte_sequence` if truncated or malformed, including a status
+which `v` could not have. `v` is unchanged after a failure.
+\requires That `R`, `S` and `P` are void, or default constructible and have a `binary_serialiser`.
+*/
+OUTCOME_TEMPLATE(class R, class S, class P, class N)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_binary_serialisable<detail::devoid<R>>::value &&detail::is_binary_serialisable<detail::devoid<S>>::value &&detail::is_binary_serialisable<detail::devoid<P>>::value))
+inline result<size_t> binary_decode(const unsigned char *buffer, size_t length, basic_outcome<R, S, P, N> &v)
+{
+  const unsigned char *end = buffer + length;
+  detail::status_bitfield_type status = 0;
+  std::error_code ec;
+  const unsigned char *in = detail::binary_decode_header(buffer, length, status, ec);
+  if(in == nullptr)
+  {
+    return ec;
+  }
+  if(!detail::status_is_valid(status, true))
+  {
+    return std::errc::illegal_byte_sequence;
+  }
+  // Decode into temporaries first so v is untouched by malformed input
+  detail::devoid<R> value{};
+  detail::devoid<S> error{};
+  detail::devoid<P> exception{};
+  in = detail::binary_field_decode(in, end, (status & detail::status_have_value) != 0, value);
+  in = detail::binary_field_decode(in, end, (status & detail::status_have_error) != 0, error);
+  in = detail::binary_field_decode(in, end, (status & detail::status_have_exception) != 0, exception);
+  if(in == nullptr)
+  {
+    return std::errc::illegal_byte_sequence;
+  }
+  auto &state = v._iostreams_state();
+  state = std::decay_t<decltype(state)>();
+  state._status = status;
+  if((status & detail::status_have_value) != 0)
+  {
+    new(&state._value) detail::devoid<R>(std::move(value));  // NOLINT
+  }
+  if((status & detail::status_have_error) != 0)
+  {
+    detail::binary_error(v, std::is_void<S>()) = std::move(error);
+  }
+  if((status & detail::status_have_exception) != 0)
+  {
+    detail::binary_exception(v, std::is_void<P>()) = std::move(exception);
+  }
+  return static_cast<size_t>(in - buffer);
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
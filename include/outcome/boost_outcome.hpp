@@ -35,8 +35,17 @@ namespace detail
 {
   namespace adl
   {
+    struct boost_failure_exception_traits
+    {
+      using error_code = boost::system::error_code;
+      using exception_ptr = boost::exception_ptr;
+      static exception_ptr from_error(const error_code &ec) { return boost::copy_exception(boost::system::system_error(ec)); }
+      static exception_ptr bad_alloc() { return boost::copy_exception(std::bad_alloc()); }
+      static exception_ptr current_exception() { return boost::current_exception(); }
+      static error_code not_enough_memory() noexcept { return boost::system::errc::make_error_code(boost::system::errc::not_enough_memory); }
+    };
     // Implement the .failure() observer.
-    inline boost::exception_ptr basic_outcome_failure_exception_from_error(const boost::system::error_code &ec, search_detail_adl /*unused*/) { return boost::copy_exception(boost::system::system_error(ec)); }
+    inline boost::exception_ptr basic_outcome_failure_exception_from_error(const boost::system::error_code &ec, search_detail_adl /*unused*/) { return failure_exception_cache<boost_failure_exception_traits>::get(ec); }
   }
 }
 
@@ -89,6 +89,31 @@ If you are not redirected automatically, follow this link to <a href='https://ne
 #ifndef OUTCOME_REQUIRES
 #define OUTCOME_REQUIRES(...) QUICKCPPLIB_REQUIRES(__VA_ARGS__)
 #endif
+#ifndef OUTCOME_DEBUG_INLINE
+// Forces the trivial observer, policy and hook layers inline even at -O0, if OUTCOME_ENABLE_DEBUG_INLINING is defined
+#if defined(OUTCOME_ENABLE_DEBUG_INLINING) && (defined(__GNUC__) || defined(__clang__))
+#define OUTCOME_DEBUG_INLINE __attribute__((always_inline))
+#else
+#define OUTCOME_DEBUG_INLINE
+#endif
+#endif
+#ifndef OUTCOME_COLD
+// Marks out of line failure handlers, so the caller keeps only a test and a jump
+#if defined(__GNUC__) || defined(__clang__)
+#define OUTCOME_COLD __attribute__((noinline, cold))
+#else
+#define OUTCOME_COLD QUICKCPPLIB_NOINLINE
+#endif
+#endif
+#ifndef OUTCOME_INLINE_CONSTEXPR
+// Declares a namespace scope constant. A C++ module interface cannot expose internal linkage
+// entities, so these are `inline` rather than `static` wherever the language has inline variables
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+#define OUTCOME_INLINE_CONSTEXPR inline constexpr
+#else
+#define OUTCOME_INLINE_CONSTEXPR static constexpr
+#endif
+#endif
 
 #include "quickcpplib/include/import.h"
 
@@ -141,21 +166,28 @@ exported Outcome v2 namespace.
 #endif
 #endif
 
+// An importer of the C++ module wants only the macros of this header
+#if !defined(IMPORTING_OUTCOME_MODULE)
+// The core of Outcome, basic_result with user defined types, needs only these. Everything
+// heavier, <system_error>, <exception> and their traits, is brought in by the headers using it
 #include <cstdint>  // for uint32_t etc
 #include <initializer_list>
-#include <iosfwd>  // for future serialisation
-#include <new>     // for placement in moves etc
+#include <new>  // for placement in moves etc
 #include <type_traits>
+#include <utility>  // for swap and in_place_type_t
 
 #if __cplusplus >= 201700 || (defined(_MSC_VER) && _HAS_CXX17)
-#include <utility>  // for in_place_type_t
-
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 template <class T> using in_place_type_t = std::in_place_type_t<T>;
+#if defined(GENERATING_OUTCOME_MODULE_INTERFACE)
+// GCC cannot export a using declaration of a variable template, so the module refers to it instead
+template <class T> inline constexpr const in_place_type_t<T> &in_place_type = std::in_place_type<T>;
+#else
 using std::in_place_type;
+#endif
 OUTCOME_V2_NAMESPACE_END
 #else
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 //! Aliases `std::in_place_type_t<T>` if on C++ 17 or later, else defined locally.
 template <class T> struct in_place_type_t
 {
@@ -231,7 +263,7 @@ namespace detail
   {
     static constexpr bool value = false;
   };
-  template <class T, class U> static constexpr bool is_explicitly_constructible = _is_explicitly_constructible<T, U>::value;
+  template <class T, class U> OUTCOME_INLINE_CONSTEXPR bool is_explicitly_constructible = _is_explicitly_constructible<T, U>::value;
 
   template <class T, class U> struct _is_implicitly_constructible
   {
@@ -245,7 +277,7 @@ namespace detail
   {
     static constexpr bool value = false;
   };
-  template <class T, class U> static constexpr bool is_implicitly_constructible = _is_implicitly_constructible<T, U>::value;
+  template <class T, class U> OUTCOME_INLINE_CONSTEXPR bool is_implicitly_constructible = _is_implicitly_constructible<T, U>::value;
 
 // True if type is nothrow swappable
 #if !defined(STANDARDESE_IS_IN_THE_HOUSE) && (_HAS_CXX17 || __cplusplus >= 201700)
@@ -315,6 +347,7 @@ OUTCOME_V2_NAMESPACE_END
 
 #endif
 #endif
+#endif  // IMPORTING_OUTCOME_MODULE
 
 #ifndef BOOST_OUTCOME_AUTO_TEST_CASE
 #define BOOST_OUTCOME_AUTO_TEST_CASE(a, b) BOOST_AUTO_TEST_CASE(a, b)
@@ -32,10 +32,27 @@ OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 //! Namespace for injected convertibility
 namespace convert
 {
-#if defined(__cpp_concepts)
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
   /* The `ValueOrNone` concept.
   \requires That `U::value_type` exists and that `std::declval<U>().has_value()` returns a `bool` and `std::declval<U>().value()` exists.
   */
+  template <class U> concept ValueOrNone = requires(U a)
+  {
+    requires std::is_convertible<decltype(a.has_value()), bool>::value;
+    {a.value()};
+  };
+  /* The `ValueOrError` concept.
+  \requires That `U::value_type` and `U::error_type` exist;
+  that `std::declval<U>().has_value()` returns a `bool`, `std::declval<U>().value()` and  `std::declval<U>().error()` exists.
+  */
+  template <class U> concept ValueOrError = requires(U a)
+  {
+    requires std::is_convertible<decltype(a.has_value()), bool>::value;
+    {a.value()};
+    {a.error()};
+  };
+#elif defined(__cpp_concepts)
+  // The Concepts TS spelling
   template <class U> concept bool ValueOrNone = requires(U a)
   {
     {
@@ -44,10 +61,6 @@ namespace convert
     ->bool;
     {a.value()};
   };
-  /* The `ValueOrError` concept.
-  \requires That `U::value_type` and `U::error_type` exist;
-  that `std::declval<U>().has_value()` returns a `bool`, `std::declval<U>().value()` and  `std::declval<U>().error()` exists.
-  */
   template <class U> concept bool ValueOrError = requires(U a)
   {
     {
@@ -72,18 +85,18 @@ namespace convert
     OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<U>().has_value()), OUTCOME_TEXPR(std::declval<U>().value()), OUTCOME_TEXPR(std::declval<U>().error()))
     inline U match_value_or_error(U &&);
 
-    template <class U> static constexpr bool ValueOrNone = !std::is_same<no_match, decltype(match_value_or_none(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
-    template <class U> static constexpr bool ValueOrError = !std::is_same<no_match, decltype(match_value_or_error(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
+    template <class U> OUTCOME_INLINE_CONSTEXPR bool ValueOrNone = !std::is_same<no_match, decltype(match_value_or_none(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
+    template <class U> OUTCOME_INLINE_CONSTEXPR bool ValueOrError = !std::is_same<no_match, decltype(match_value_or_error(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
   }  // namespace detail
   /* The `ValueOrNone` concept.
   \requires That `U::value_type` exists and that `std::declval<U>().has_value()` returns a `bool` and `std::declval<U>().value()` exists.
   */
-  template <class U> static constexpr bool ValueOrNone = detail::ValueOrNone<U>;
+  template <class U> OUTCOME_INLINE_CONSTEXPR bool ValueOrNone = detail::ValueOrNone<U>;
   /* The `ValueOrError` concept.
   \requires That `U::value_type` and `U::error_type` exist;
   that `std::declval<U>().has_value()` returns a `bool`, `std::declval<U>().value()` and  `std::declval<U>().error()` exists.
   */
-  template <class U> static constexpr bool ValueOrError = detail::ValueOrError<U>;
+  template <class U> OUTCOME_INLINE_CONSTEXPR bool ValueOrError = detail::ValueOrError<U>;
 #endif
 
   namespace detail
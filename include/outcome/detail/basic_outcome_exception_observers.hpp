@@ -25,15 +25,17 @@ http://www.boost.org/LICENSE_1_0.txt)
 #ifndef OUTCOME_BASIC_OUTCOME_EXCEPTION_OBSERVERS_HPP
 #define OUTCOME_BASIC_OUTCOME_EXCEPTION_OBSERVERS_HPP
 
-#include "basic_result_storage.hpp"
+#include "basic_result_final.hpp"
 
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
   //! The exception observers implementation of `basic_outcome<R, S, P>`.
-  template <class Base, class R, class S, class P, class NoValuePolicy> class basic_outcome_exception_observers : public Base
+  template <class R, class S, class P, class NoValuePolicy> class basic_outcome_exception_observers : public basic_result_final<R, S, NoValuePolicy>
   {
+    using Base = basic_result_final<R, S, NoValuePolicy>;
+
   public:
     using exception_type = P;
     using Base::Base;
@@ -44,13 +46,13 @@ namespace detail
     \returns Reference to the held `exception_type` according to overload.
     \group assume_exception
     */
-    constexpr inline exception_type &assume_exception() & noexcept;
+    constexpr inline OUTCOME_DEBUG_INLINE exception_type &assume_exception() & noexcept;
     /// \group assume_exception
-    constexpr inline const exception_type &assume_exception() const &noexcept;
+    constexpr inline OUTCOME_DEBUG_INLINE const exception_type &assume_exception() const &noexcept;
     /// \group assume_exception
-    constexpr inline exception_type &&assume_exception() && noexcept;
+    constexpr inline OUTCOME_DEBUG_INLINE exception_type &&assume_exception() && noexcept;
     /// \group assume_exception
-    constexpr inline const exception_type &&assume_exception() const &&noexcept;
+    constexpr inline OUTCOME_DEBUG_INLINE const exception_type &&assume_exception() const &&noexcept;
 
     /// \output_section Wide state observers
     /*! Access exception with runtime checks.
@@ -58,29 +60,31 @@ namespace detail
     \requires The outcome to have an exception state, else whatever `NoValuePolicy` says ought to happen.
     \group exception
     */
-    constexpr inline exception_type &exception() &;
+    constexpr inline OUTCOME_DEBUG_INLINE exception_type &exception() &;
     /// \group exception
-    constexpr inline const exception_type &exception() const &;
+    constexpr inline OUTCOME_DEBUG_INLINE const exception_type &exception() const &;
     /// \group exception
-    constexpr inline exception_type &&exception() &&;
+    constexpr inline OUTCOME_DEBUG_INLINE exception_type &&exception() &&;
     /// \group exception
-    constexpr inline const exception_type &&exception() const &&;
+    constexpr inline OUTCOME_DEBUG_INLINE const exception_type &&exception() const &&;
   };
 
   // Exception observers not present
-  template <class Base, class R, class S, class NoValuePolicy> class basic_outcome_exception_observers<Base, R, S, void, NoValuePolicy> : public Base
+  template <class R, class S, class NoValuePolicy> class basic_outcome_exception_observers<R, S, void, NoValuePolicy> : public basic_result_final<R, S, NoValuePolicy>
   {
+    using Base = basic_result_final<R, S, NoValuePolicy>;
+
   public:
     using Base::Base;
     /// \output_section Narrow state observers
     /*! Access exception without runtime checks.
     */
-    constexpr void assume_exception() const noexcept { NoValuePolicy::narrow_exception_check(this); }
+    constexpr OUTCOME_DEBUG_INLINE void assume_exception() const noexcept { NoValuePolicy::narrow_exception_check(this); }
     /// \output_section Wide state observers
     /*! Access exception with runtime checks.
     \requires The outcome to have an exception state, else whatever `NoValuePolicy` says ought to happen.
     */
-    constexpr void exception() const { NoValuePolicy::wide_exception_check(this); }
+    constexpr OUTCOME_DEBUG_INLINE void exception() const { NoValuePolicy::wide_exception_check(this); }
   };
 
 }  // namespace detail
@@ -50,44 +50,60 @@ namespace policy
 
 namespace detail
 {
-  template <class Base, class R, class S, class P, class NoValuePolicy> inline constexpr typename basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::exception_type &basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::assume_exception() & noexcept
+  template <class R, class S, class P, class NoValuePolicy> inline constexpr typename basic_outcome_exception_observers<R, S, P, NoValuePolicy>::exception_type &basic_outcome_exception_observers<R, S, P, NoValuePolicy>::assume_exception() & noexcept
   {
+    using namespace hooks;
+    hook_outcome_exception_observation(static_cast<const Base *>(this));
     NoValuePolicy::narrow_exception_check(*this);
     return NoValuePolicy::template _exception<R, S, P, NoValuePolicy>(*this);
   }
-  template <class Base, class R, class S, class P, class NoValuePolicy> inline constexpr const typename basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::exception_type &basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::assume_exception() const &noexcept
+  template <class R, class S, class P, class NoValuePolicy> inline constexpr const typename basic_outcome_exception_observers<R, S, P, NoValuePolicy>::exception_type &basic_outcome_exception_observers<R, S, P, NoValuePolicy>::assume_exception() const &noexcept
   {
+    using namespace hooks;
+    hook_outcome_exception_observation(static_cast<const Base *>(this));
     NoValuePolicy::narrow_exception_check(*this);
     return NoValuePolicy::template _exception<R, S, P, NoValuePolicy>(*this);
   }
-  template <class Base, class R, class S, class P, class NoValuePolicy> inline constexpr typename basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::exception_type &&basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::assume_exception() && noexcept
+  template <class R, class S, class P, class NoValuePolicy> inline constexpr typename basic_outcome_exception_observers<R, S, P, NoValuePolicy>::exception_type &&basic_outcome_exception_observers<R, S, P, NoValuePolicy>::assume_exception() && noexcept
   {
+    using namespace hooks;
+    hook_outcome_exception_observation(static_cast<const Base *>(this));
     NoValuePolicy::narrow_exception_check(std::move(*this));
     return NoValuePolicy::template _exception<R, S, P, NoValuePolicy>(std::move(*this));
   }
-  template <class Base, class R, class S, class P, class NoValuePolicy> inline constexpr const typename basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::exception_type &&basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::assume_exception() const &&noexcept
+  template <class R, class S, class P, class NoValuePolicy> inline constexpr const typename basic_outcome_exception_observers<R, S, P, NoValuePolicy>::exception_type &&basic_outcome_exception_observers<R, S, P, NoValuePolicy>::assume_exception() const &&noexcept
   {
+    using namespace hooks;
+    hook_outcome_exception_observation(static_cast<const Base *>(this));
     NoValuePolicy::narrow_exception_check(std::move(*this));
     return NoValuePolicy::template _exception<R, S, P, NoValuePolicy>(std::move(*this));
   }
 
-  template <class Base, class R, class S, class P, class NoValuePolicy> inline constexpr typename basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::exception_type &basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::exception() &
+  template <class R, class S, class P, class NoValuePolicy> inline constexpr typename basic_outcome_exception_observers<R, S, P, NoValuePolicy>::exception_type &basic_outcome_exception_observers<R, S, P, NoValuePolicy>::exception() &
   {
+    using namespace hooks;
+    hook_outcome_exception_observation(static_cast<const Base *>(this));
     NoValuePolicy::wide_exception_check(*this);
     return NoValuePolicy::template _exception<R, S, P, NoValuePolicy>(*this);
   }
-  template <class Base, class R, class S, class P, class NoValuePolicy> inline constexpr const typename basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::exception_type &basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::exception() const &
+  template <class R, class S, class P, class NoValuePolicy> inline constexpr const typename basic_outcome_exception_observers<R, S, P, NoValuePolicy>::exception_type &basic_outcome_exception_observers<R, S, P, NoValuePolicy>::exception() const &
   {
+    using namespace hooks;
+    hook_outcome_exception_observation(static_cast<const Base *>(this));
     NoValuePolicy::wide_exception_check(*this);
     return NoValuePolicy::template _exception<R, S, P, NoValuePolicy>(*this);
   }
-  template <class Base, class R, class S, class P, class NoValuePolicy> inline constexpr typename basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::exception_type &&basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::exception() &&
+  template <class R, class S, class P, class NoValuePolicy> inline constexpr typename basic_outcome_exception_observers<R, S, P, NoValuePolicy>::exception_type &&basic_outcome_exception_observers<R, S, P, NoValuePolicy>::exception() &&
   {
+    using namespace hooks;
+    hook_outcome_exception_observation(static_cast<const Base *>(this));
     NoValuePolicy::wide_exception_check(std::move(*this));
     return NoValuePolicy::template _exception<R, S, P, NoValuePolicy>(std::move(*this));
   }
-  template <class Base, class R, class S, class P, class NoValuePolicy> inline constexpr const typename basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::exception_type &&basic_outcome_exception_observers<Base, R, S, P, NoValuePolicy>::exception() const &&
+  template <class R, class S, class P, class NoValuePolicy> inline constexpr const typename basic_outcome_exception_observers<R, S, P, NoValuePolicy>::exception_type &&basic_outcome_exception_observers<R, S, P, NoValuePolicy>::exception() const &&
   {
+    using namespace hooks;
+    hook_outcome_exception_observation(static_cast<const Base *>(this));
     NoValuePolicy::wide_exception_check(std::move(*this));
     return NoValuePolicy::template _exception<R, S, P, NoValuePolicy>(std::move(*this));
   }
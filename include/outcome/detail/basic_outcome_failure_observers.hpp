@@ -25,7 +25,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 #ifndef OUTCOME_BASIC_OUTCOME_FAILURE_OBSERVERS_HPP
 #define OUTCOME_BASIC_OUTCOME_FAILURE_OBSERVERS_HPP
 
-#include "basic_result_storage.hpp"
+#include "basic_outcome_exception_observers.hpp"
 
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
@@ -45,8 +45,10 @@ namespace detail
 #endif
 
   //! The failure observers implementation of `basic_outcome<R, S, P>`.
-  template <class Base, class R, class S, class P, class NoValuePolicy> class basic_outcome_failure_observers : public Base
+  template <class R, class S, class P, class NoValuePolicy> class basic_outcome_failure_observers : public basic_outcome_exception_observers<R, S, P, NoValuePolicy>
   {
+    using Base = basic_outcome_exception_observers<R, S, P, NoValuePolicy>;
+
   public:
     using exception_type = P;
     using Base::Base;
@@ -55,7 +57,8 @@ namespace detail
     /*! Synthesise exception where possible.
     \requires `trait::has_error_code_v<S>` and `trait::has_exception_ptr_v<P>` to be true, else it does not appear.
     \returns A synthesised exception type: if excepted, `exception()`; if errored, `xxx::make_exception_ptr(xxx::system_error(error()))`;
-    otherwise a default constructed exception type.
+    otherwise a default constructed exception type. Synthesised exceptions are cached per error category and value,
+    so repeated calls for the same error return the same immutable exception without allocating.
     */
     exception_type failure() const noexcept
     {
@@ -25,15 +25,17 @@ http://www.boost.org/LICENSE_1_0.txt)
 #ifndef OUTCOME_BASIC_RESULT_ERROR_OBSERVERS_HPP
 #define OUTCOME_BASIC_RESULT_ERROR_OBSERVERS_HPP
 
-#include "basic_result_storage.hpp"
+#include "basic_result_value_observers.hpp"
 
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
   //! The error observers implementation of `basic_result<R, EC, NoValuePolicy>`.
-  template <class Base, class EC, class NoValuePolicy> class basic_result_error_observers : public Base
+  template <class R, class EC, class NoValuePolicy> class basic_result_error_observers : public basic_result_value_observers<R, EC, NoValuePolicy>
   {
+    using Base = basic_result_value_observers<R, EC, NoValuePolicy>;
+
   public:
     using error_type = EC;
     using Base::Base;
@@ -44,26 +46,30 @@ namespace detail
     \returns Reference to the held `error_type` according to overload.
     \group assume_error
     */
-    constexpr error_type &assume_error() & noexcept
+    constexpr OUTCOME_DEBUG_INLINE error_type &assume_error() & noexcept
     {
+      this->_observe_error();
       NoValuePolicy::narrow_error_check(static_cast<basic_result_error_observers &>(*this));
       return this->_error;
     }
     /// \group assume_error
-    constexpr const error_type &assume_error() const &noexcept
+    constexpr OUTCOME_DEBUG_INLINE const error_type &assume_error() const &noexcept
     {
+      this->_observe_error();
       NoValuePolicy::narrow_error_check(static_cast<const basic_result_error_observers &>(*this));
       return this->_error;
     }
     /// \group assume_error
-    constexpr error_type &&assume_error() && noexcept
+    constexpr OUTCOME_DEBUG_INLINE error_type &&assume_error() && noexcept
     {
+      this->_observe_error();
       NoValuePolicy::narrow_error_check(static_cast<basic_result_error_observers &&>(*this));
       return static_cast<error_type &&>(this->_error);
     }
     /// \group assume_error
-    constexpr const error_type &&assume_error() const &&noexcept
+    constexpr OUTCOME_DEBUG_INLINE const error_type &&assume_error() const &&noexcept
     {
+      this->_observe_error();
       NoValuePolicy::narrow_error_check(static_cast<const basic_result_error_observers &&>(*this));
       return static_cast<const error_type &&>(this->_error);
     }
@@ -74,43 +80,57 @@ namespace detail
     \requires The basic_result to have a failed state, else whatever `NoValuePolicy` says ought to happen.
     \group error
     */
-    constexpr error_type &error() &
+    constexpr OUTCOME_DEBUG_INLINE error_type &error() &
     {
+      this->_observe_error();
       NoValuePolicy::wide_error_check(static_cast<basic_result_error_observers &>(*this));
       return this->_error;
     }
     /// \group error
-    constexpr const error_type &error() const &
+    constexpr OUTCOME_DEBUG_INLINE const error_type &error() const &
     {
+      this->_observe_error();
       NoValuePolicy::wide_error_check(static_cast<const basic_result_error_observers &>(*this));
       return this->_error;
     }
     /// \group error
-    constexpr error_type &&error() &&
+    constexpr OUTCOME_DEBUG_INLINE error_type &&error() &&
     {
+      this->_observe_error();
       NoValuePolicy::wide_error_check(static_cast<basic_result_error_observers &&>(*this));
       return static_cast<error_type &&>(this->_error);
     }
     /// \group error
-    constexpr const error_type &&error() const &&
+    constexpr OUTCOME_DEBUG_INLINE const error_type &&error() const &&
     {
+      this->_observe_error();
       NoValuePolicy::wide_error_check(static_cast<const basic_result_error_observers &&>(*this));
       return static_cast<const error_type &&>(this->_error);
     }
   };
-  template <class Base, class NoValuePolicy> class basic_result_error_observers<Base, void, NoValuePolicy> : public Base
+  template <class R, class NoValuePolicy> class basic_result_error_observers<R, void, NoValuePolicy> : public basic_result_value_observers<R, void, NoValuePolicy>
   {
+    using Base = basic_result_value_observers<R, void, NoValuePolicy>;
+
   public:
     using Base::Base;
     /// \output_section Narrow state observers
     /*! Access error without runtime checks.
     */
-    constexpr void assume_error() const noexcept { NoValuePolicy::narrow_error_check(*this); }
+    constexpr OUTCOME_DEBUG_INLINE void assume_error() const noexcept
+    {
+      this->_observe_error();
+      NoValuePolicy::narrow_error_check(*this);
+    }
     /// \output_section Wide state observers
     /*! Access error with runtime checks.
     \requires The basic_result to have a failed state, else whatever `NoValuePolicy` says ought to happen.
     */
-    constexpr void error() const { NoValuePolicy::wide_error_check(*this); }
+    constexpr OUTCOME_DEBUG_INLINE void error() const
+    {
+      this->_observe_error();
+      NoValuePolicy::wide_error_check(*this);
+    }
   };
 }  // namespace detail
 OUTCOME_V2_NAMESPACE_END
@@ -26,19 +26,153 @@ http://www.boost.org/LICENSE_1_0.txt)
 #define OUTCOME_BASIC_RESULT_FINAL_HPP
 
 #include "basic_result_error_observers.hpp"
-#include "basic_result_value_observers.hpp"
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#include <atomic>
+#endif
 
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
-  template <class R, class EC, class NoValuePolicy> using select_basic_result_impl = basic_result_error_observers<basic_result_value_observers<basic_result_storage<R, EC, NoValuePolicy>, R, NoValuePolicy>, EC, NoValuePolicy>;
+  /* Whether the state of a result or outcome has been observed. Observing does not modify
+  the state, so is done through `const` and perhaps from several threads at once, hence
+  this is a relaxed atomic.
+  */
+  class observed_flag
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    bool _v{false};
+
+  public:
+    bool load() const noexcept { return __atomic_load_n(&_v, __ATOMIC_RELAXED); }
+    void store(bool v) noexcept { __atomic_store_n(&_v, v, __ATOMIC_RELAXED); }
+#else
+    std::atomic<bool> _v{false};
+
+  public:
+    bool load() const noexcept { return _v.load(std::memory_order_relaxed); }
+    void store(bool v) noexcept { _v.store(v, std::memory_order_relaxed); }
+#endif
+    observed_flag() = default;
+    observed_flag(const observed_flag &) = delete;
+    observed_flag &operator=(const observed_flag &) = delete;
+  };
+
+  /*! Adds a destructor calling `hook_result_destruction()` to the implementation of `basic_result<R, S, NoValuePolicy>`.
+  Assigning over the state also calls it first, as the state assigned over is dropped just the same.
+  */
+  template <class R, class S, class NoValuePolicy> class basic_result_destruction_hook : public basic_result_error_observers<R, S, NoValuePolicy>
+  {
+    using Base = basic_result_error_observers<R, S, NoValuePolicy>;
+
+    struct disable_copy_constructor
+    {
+    };
+    struct disable_move_constructor
+    {
+    };
+    struct disable_copy_assignment
+    {
+    };
+    struct disable_move_assignment
+    {
+    };
+    using _copy_constructor_type = std::conditional_t<std::is_copy_constructible<Base>::value, basic_result_destruction_hook, disable_copy_constructor>;
+    using _move_constructor_type = std::conditional_t<std::is_move_constructible<Base>::value, basic_result_destruction_hook, disable_move_constructor>;
+    using _copy_assignment_type = std::conditional_t<std::is_copy_assignable<Base>::value, basic_result_destruction_hook, disable_copy_assignment>;
+    using _move_assignment_type = std::conditional_t<std::is_move_assignable<Base>::value, basic_result_destruction_hook, disable_move_assignment>;
+
+    mutable observed_flag _observed;
+
+    // Copying, moving or converting from another result or outcome hands on the responsibility to observe its state
+    template <class T, class U, class V> void _hand_on_observation(const basic_result_storage<T, U, V> &o) noexcept
+    {
+      const auto *from = static_cast<const basic_result_final<T, U, V> *>(&o);
+      _observed.store(hooks::has_been_observed(from));
+      hooks::mark_as_observed(from);
+    }
+    void _call_destruction_hook() noexcept
+    {
+      using namespace hooks;
+      hook_result_destruction(static_cast<basic_result_final<R, S, NoValuePolicy> *>(this));
+    }
+
+  public:
+    using Base::Base;
 
-  //! The assembled implementation type of `basic_result<R, S, NoValuePolicy>`.
+    basic_result_destruction_hook() = default;
+    basic_result_destruction_hook(const _copy_constructor_type &o) noexcept(std::is_nothrow_copy_constructible<Base>::value)  // NOLINT
+        : Base(o)
+    {
+      _hand_on_observation(o);
+    }
+    basic_result_destruction_hook(_move_constructor_type &&o) noexcept(std::is_nothrow_move_constructible<Base>::value)  // NOLINT
+        : Base(static_cast<Base &&>(o))
+    {
+      _hand_on_observation(o);
+    }
+    // Preferred over the converting constructors inherited from basic_result_storage
+    template <class T>
+    basic_result_destruction_hook(typename Base::compatible_conversion_tag _, T &&o) noexcept(std::is_nothrow_constructible<Base, typename Base::compatible_conversion_tag, T>::value)
+        : Base(_, static_cast<T &&>(o))
+    {
+      _hand_on_observation(o);
+    }
+    basic_result_destruction_hook &operator=(const _copy_assignment_type &o) noexcept(std::is_nothrow_copy_assignable<Base>::value)  // NOLINT
+    {
+      if(this != &o)
+      {
+        _call_destruction_hook();
+        Base::operator=(o);
+        _hand_on_observation(o);
+      }
+      return *this;
+    }
+    basic_result_destruction_hook &operator=(_move_assignment_type &&o) noexcept(std::is_nothrow_move_assignable<Base>::value)  // NOLINT
+    {
+      if(this != &o)
+      {
+        _call_destruction_hook();
+        Base::operator=(static_cast<Base &&>(o));
+        _hand_on_observation(o);
+      }
+      return *this;
+    }
+    ~basic_result_destruction_hook() { _call_destruction_hook(); }
+
+    // Used by the observation hooks to record observation
+    observed_flag &_observed_flag() const noexcept { return _observed; }
+  };
+
+  // Where the observation of the state of r is recorded, if anywhere
+  template <class T> inline observed_flag *observed_flag_of(const T *r, std::true_type /*has destruction hook*/) noexcept { return &r->_observed_flag(); }
+  template <class T> constexpr inline observed_flag *observed_flag_of(const T * /*unused*/, std::false_type /*has destruction hook*/) noexcept { return nullptr; }
+  template <class R, class S, class NoValuePolicy> constexpr inline observed_flag *observed_flag_of(const basic_result_final<R, S, NoValuePolicy> *r) noexcept
+  {
+    return observed_flag_of(r, std::is_base_of<basic_result_destruction_hook<R, S, NoValuePolicy>, basic_result_final<R, S, NoValuePolicy>>());
+  }
+
+  namespace hook_result_destruction_lookup
+  {
+    using namespace hooks;
+    template <class T> using type = decltype(hook_result_destruction(static_cast<T *>(nullptr)));
+  }  // namespace hook_result_destruction_lookup
+  /* Only add a destructor if the destruction hook has been customised for this type, so
+  `basic_result` remains trivially destructible if `R` and `S` are.
+  */
+  template <class R, class S, class NoValuePolicy>
+  using select_basic_result_impl = std::conditional_t<std::is_same<hook_result_destruction_lookup::type<basic_result_final<R, S, NoValuePolicy>>, hook_result_destruction_not_customised>::value, basic_result_error_observers<R, S, NoValuePolicy>, basic_result_destruction_hook<R, S, NoValuePolicy>>;
+
+  /*! The assembled implementation type of `basic_result<R, S, NoValuePolicy>`. Each layer
+  below it is parameterised by `R, S, NoValuePolicy` alone and names its own base, rather
+  than taking the layer below as a template parameter, so symbols and debug info spell each
+  layer in three types instead of nesting every layer beneath.
+  */
   template <class R, class S, class NoValuePolicy>
   class basic_result_final
 #if defined(DOXYGEN_IS_IN_THE_HOUSE)
-  : public basic_result_error_observers<basic_result_value_observers<basic_result_storage<R, S, NoValuePolicy>, R, NoValuePolicy>, S, NoValuePolicy>
+  : public basic_result_error_observers<R, S, NoValuePolicy>
 #else
   : public select_basic_result_impl<R, S, NoValuePolicy>
 #endif
@@ -52,23 +186,43 @@ namespace detail
     /*! Checks if has value.
     \returns True if has value.
     */
-    constexpr explicit operator bool() const noexcept { return (this->_state._status & detail::status_have_value) != 0; }
+    constexpr OUTCOME_DEBUG_INLINE explicit operator bool() const noexcept
+    {
+      this->_observe_state();
+      return (this->_state._status & detail::status_have_value) != 0;
+    }
     /*! Checks if has value.
     \returns True if has value.
     */
-    constexpr bool has_value() const noexcept { return (this->_state._status & detail::status_have_value) != 0; }
+    constexpr OUTCOME_DEBUG_INLINE bool has_value() const noexcept
+    {
+      this->_observe_state();
+      return (this->_state._status & detail::status_have_value) != 0;
+    }
     /*! Checks if has error.
     \returns True if has error.
     */
-    constexpr bool has_error() const noexcept { return (this->_state._status & detail::status_have_error) != 0; }
+    constexpr OUTCOME_DEBUG_INLINE bool has_error() const noexcept
+    {
+      this->_observe_state();
+      return (this->_state._status & detail::status_have_error) != 0;
+    }
     /*! Checks if has exception.
     \returns True if has exception.
     */
-    constexpr bool has_exception() const noexcept { return (this->_state._status & detail::status_have_exception) != 0; }
+    constexpr OUTCOME_DEBUG_INLINE bool has_exception() const noexcept
+    {
+      this->_observe_state();
+      return (this->_state._status & detail::status_have_exception) != 0;
+    }
     /*! Checks if has error or exception.
     \returns True if has error or exception.
     */
-    constexpr bool has_failure() const noexcept { return (this->_state._status & detail::status_have_error) != 0 || (this->_state._status & detail::status_have_exception) != 0; }
+    constexpr OUTCOME_DEBUG_INLINE bool has_failure() const noexcept
+    {
+      this->_observe_state();
+      return (this->_state._status & detail::status_have_error) != 0 || (this->_state._status & detail::status_have_exception) != 0;
+    }
 
     /// \output_section Comparison operators
     /*! True if equal to the other basic_result.
@@ -86,6 +240,8 @@ namespace detail
     constexpr bool operator==(const basic_result_final<T, U, V> &o) const noexcept(  //
     noexcept(std::declval<detail::devoid<R>>() == std::declval<detail::devoid<T>>()) && noexcept(std::declval<detail::devoid<S>>() == std::declval<detail::devoid<U>>()))
     {
+      this->_observe_state();
+      o._observe_state();
       if((this->_state._status & detail::status_have_value) != 0 && (o._state._status & detail::status_have_value) != 0)
       {
         return this->_state._value == o._state._value;
@@ -109,6 +265,7 @@ namespace detail
     constexpr bool operator==(const success_type<T> &o) const noexcept(  //
     noexcept(std::declval<R>() == std::declval<T>()))
     {
+      this->_observe_state();
       if((this->_state._status & detail::status_have_value) != 0)
       {
         return this->_state._value == o.value();
@@ -123,6 +280,7 @@ namespace detail
     constexpr bool operator==(const success_type<void> &o) const noexcept
     {
       (void) o;
+      this->_observe_state();
       return (this->_state._status & detail::status_have_value) != 0;
     }
     /*! True if equal to the failure type sugar.
@@ -138,6 +296,7 @@ namespace detail
     constexpr bool operator==(const failure_type<T, void> &o) const noexcept(  //
     noexcept(std::declval<S>() == std::declval<T>()))
     {
+      this->_observe_state();
       if((this->_state._status & detail::status_have_error) != 0)
       {
         return this->_error == o.error();
@@ -159,6 +318,8 @@ namespace detail
     constexpr bool operator!=(const basic_result_final<T, U, V> &o) const noexcept(  //
     noexcept(std::declval<detail::devoid<R>>() != std::declval<detail::devoid<T>>()) && noexcept(std::declval<detail::devoid<S>>() != std::declval<detail::devoid<U>>()))
     {
+      this->_observe_state();
+      o._observe_state();
       if((this->_state._status & detail::status_have_value) != 0 && (o._state._status & detail::status_have_value) != 0)
       {
         return this->_state._value != o._state._value;
@@ -182,6 +343,7 @@ namespace detail
     constexpr bool operator!=(const success_type<T> &o) const noexcept(  //
     noexcept(std::declval<R>() != std::declval<T>()))
     {
+      this->_observe_state();
       if((this->_state._status & detail::status_have_value) != 0)
       {
         return this->_state._value != o.value();
@@ -196,6 +358,7 @@ namespace detail
     constexpr bool operator!=(const success_type<void> &o) const noexcept
     {
       (void) o;
+      this->_observe_state();
       return (this->_state._status & detail::status_have_value) == 0;
     }
     /*! True if not equal to the failure type sugar.
@@ -211,6 +374,7 @@ namespace detail
     constexpr bool operator!=(const failure_type<T, void> &o) const noexcept(  //
     noexcept(std::declval<S>() != std::declval<T>()))
     {
+      this->_observe_state();
       if((this->_state._status & detail::status_have_error) != 0)
       {
         return this->_error != o.error();
@@ -226,7 +390,7 @@ namespace detail
   \remarks Implemented as `b == a`.
   \throws Any exception the `operator==` operation might throw.
   */
-  template <class T, class U, class V, class W> constexpr inline bool operator==(const success_type<W> &a, const basic_result_final<T, U, V> &b) noexcept(noexcept(b == a)) { return b == a; }
+  template <class T, class U, class V, class W> constexpr inline bool operator==(const success_type<W> &a, const basic_result_final<T, U, V> &b) noexcept(noexcept(std::declval<const basic_result_final<T, U, V> &>() == std::declval<const success_type<W> &>())) { return b == a; }
   /*! True if the basic_result is equal to the failure type sugar.
   \param a The failure type sugar to compare.
   \param b The basic_result to compare.
@@ -235,7 +399,7 @@ namespace detail
   \remarks Implemented as `b == a`.
   \throws Any exception the `operator==` operation might throw.
   */
-  template <class T, class U, class V, class W> constexpr inline bool operator==(const failure_type<W, void> &a, const basic_result_final<T, U, V> &b) noexcept(noexcept(b == a)) { return b == a; }
+  template <class T, class U, class V, class W> constexpr inline bool operator==(const failure_type<W, void> &a, const basic_result_final<T, U, V> &b) noexcept(noexcept(std::declval<const basic_result_final<T, U, V> &>() == std::declval<const failure_type<W, void> &>())) { return b == a; }
   /*! True if the basic_result is not equal to the success type sugar.
   \param a The success type sugar to compare.
   \param b The basic_result to compare.
@@ -244,7 +408,7 @@ namespace detail
   \remarks Implemented as `b != a`.
   \throws Any exception the `operator!=` operation might throw.
   */
-  template <class T, class U, class V, class W> constexpr inline bool operator!=(const success_type<W> &a, const basic_result_final<T, U, V> &b) noexcept(noexcept(b == a)) { return b != a; }
+  template <class T, class U, class V, class W> constexpr inline bool operator!=(const success_type<W> &a, const basic_result_final<T, U, V> &b) noexcept(noexcept(std::declval<const basic_result_final<T, U, V> &>() == std::declval<const success_type<W> &>())) { return b != a; }
   /*! True if the basic_result is not equal to the failure type sugar.
   \param a The failure type sugar to compare.
   \param b The basic_result to compare.
@@ -253,7 +417,7 @@ namespace detail
   \remarks Implemented as `b != a`.
   \throws Any exception the `operator!=` operation might throw.
   */
-  template <class T, class U, class V, class W> constexpr inline bool operator!=(const failure_type<W, void> &a, const basic_result_final<T, U, V> &b) noexcept(noexcept(b == a)) { return b != a; }
+  template <class T, class U, class V, class W> constexpr inline bool operator!=(const failure_type<W, void> &a, const basic_result_final<T, U, V> &b) noexcept(noexcept(std::declval<const basic_result_final<T, U, V> &>() == std::declval<const failure_type<W, void> &>())) { return b != a; }
 }  // namespace detail
 
 OUTCOME_V2_NAMESPACE_END
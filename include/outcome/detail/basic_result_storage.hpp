@@ -29,12 +29,20 @@ http://www.boost.org/LICENSE_1_0.txt)
 #include "../trait.hpp"
 #include "value_storage.hpp"
 
+#ifdef OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING
+#include <atomic>
+#endif
+
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
   template <class State, class E> constexpr inline void _set_error_is_errno(State & /*unused*/, const E & /*unused*/) {}
   template <class R, class S, class NoValuePolicy> class basic_result_final;
+  // Returned by the default destruction hook so we can tell when it has not been customised
+  struct hook_result_destruction_not_customised
+  {
+  };
 }
 
 //! Namespace containing hooks used for intercepting and manipulating `basic_result`/`basic_outcome`
@@ -44,6 +52,22 @@ namespace hooks
   template <class R, class S, class NoValuePolicy> constexpr inline uint16_t spare_storage(const detail::basic_result_final<R, S, NoValuePolicy> *r) noexcept;
   //! Sets the sixteen bits of spare storage in a `basic_result` or `basic_outcome`.
   template <class R, class S, class NoValuePolicy> constexpr inline void set_spare_storage(detail::basic_result_final<R, S, NoValuePolicy> *r, uint16_t v) noexcept;
+  //! True if the state of a `basic_result` or `basic_outcome` has been marked as observed.
+  template <class R, class S, class NoValuePolicy> constexpr inline bool has_been_observed(const detail::basic_result_final<R, S, NoValuePolicy> *r) noexcept;
+  //! Marks the state of a `basic_result` or `basic_outcome` as having been observed.
+  template <class R, class S, class NoValuePolicy> inline void mark_as_observed(const detail::basic_result_final<R, S, NoValuePolicy> *r) noexcept;
+  //! True if a `basic_result` or `basic_outcome` has failed, and its state has not been marked as observed.
+  template <class R, class S, class NoValuePolicy> constexpr inline bool has_unobserved_failure(const detail::basic_result_final<R, S, NoValuePolicy> *r) noexcept;
+
+#ifdef OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING
+  template <class T> inline void hook_result_destruction(T *r) noexcept;
+#else
+  template <class T> constexpr inline detail::hook_result_destruction_not_customised hook_result_destruction(T * /*unused*/) noexcept;
+#endif
+  template <class T> constexpr inline OUTCOME_DEBUG_INLINE void hook_result_state_observation(const T *r) noexcept;
+  template <class T> constexpr inline OUTCOME_DEBUG_INLINE void hook_result_value_observation(const T *r) noexcept;
+  template <class T> constexpr inline OUTCOME_DEBUG_INLINE void hook_result_error_observation(const T *r) noexcept;
+  template <class T> constexpr inline OUTCOME_DEBUG_INLINE void hook_outcome_exception_observation(const T *r) noexcept;
 }  // namespace hooks
 
 namespace policy
@@ -67,6 +91,7 @@ namespace detail
     template <class T, class U, class V> friend class basic_result_final;
     template <class T, class U, class V> friend constexpr inline uint16_t hooks::spare_storage(const detail::basic_result_final<T, U, V> *r) noexcept;        // NOLINT
     template <class T, class U, class V> friend constexpr inline void hooks::set_spare_storage(detail::basic_result_final<T, U, V> *r, uint16_t v) noexcept;  // NOLINT
+    template <class T, class U, class V> friend constexpr inline bool hooks::has_unobserved_failure(const detail::basic_result_final<T, U, V> *r) noexcept;  // NOLINT
 
     struct disable_in_place_value_type
     {
@@ -99,6 +124,23 @@ namespace detail
     basic_result_storage &operator=(basic_result_storage &&) = default;       // NOLINT
     ~basic_result_storage() = default;
 
+    // Calls the observation hooks with the assembled implementation type
+    constexpr OUTCOME_DEBUG_INLINE void _observe_state() const noexcept
+    {
+      using namespace hooks;
+      hook_result_state_observation(static_cast<const basic_result_final<R, EC, NoValuePolicy> *>(this));
+    }
+    constexpr OUTCOME_DEBUG_INLINE void _observe_value() const noexcept
+    {
+      using namespace hooks;
+      hook_result_value_observation(static_cast<const basic_result_final<R, EC, NoValuePolicy> *>(this));
+    }
+    constexpr OUTCOME_DEBUG_INLINE void _observe_error() const noexcept
+    {
+      using namespace hooks;
+      hook_result_error_observation(static_cast<const basic_result_final<R, EC, NoValuePolicy> *>(this));
+    }
+
     template <class... Args>
     constexpr explicit basic_result_storage(in_place_type_t<_value_type> _, Args &&... args) noexcept(std::is_nothrow_constructible<_value_type, Args...>::value)
         : _state{_, static_cast<Args &&>(args)...}
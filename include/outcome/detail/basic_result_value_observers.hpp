@@ -31,9 +31,15 @@ OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
+  // A policy may supply the value the const wide observers return, as it cannot give a const object a missing value
+  template <class NoValuePolicy, class Impl, class T> constexpr inline auto wide_const_value(const Impl &self, const T &value, int /*unused*/) -> decltype(NoValuePolicy::wide_const_value(self, value)) { return NoValuePolicy::wide_const_value(self, value); }
+  template <class NoValuePolicy, class Impl, class T> constexpr inline const T &wide_const_value(const Impl & /*unused*/, const T &value, long /*unused*/) noexcept { return value; }
+
   //! The value observers implementation of `basic_result<R, EC, NoValuePolicy>`.
-  template <class Base, class R, class NoValuePolicy> class basic_result_value_observers : public Base
+  template <class R, class EC, class NoValuePolicy> class basic_result_value_observers : public basic_result_storage<R, EC, NoValuePolicy>
   {
+    using Base = basic_result_storage<R, EC, NoValuePolicy>;
+
   public:
     using value_type = R;
     using Base::Base;
@@ -44,26 +50,30 @@ namespace detail
     \returns Reference to the held `value_type` according to overload.
     \group assume_value
     */
-    constexpr value_type &assume_value() & noexcept
+    constexpr OUTCOME_DEBUG_INLINE value_type &assume_value() & noexcept
     {
+      this->_observe_value();
       NoValuePolicy::narrow_value_check(static_cast<basic_result_value_observers &>(*this));
       return this->_state._value;  // NOLINT
     }
     /// \group assume_value
-    constexpr const value_type &assume_value() const &noexcept
+    constexpr OUTCOME_DEBUG_INLINE const value_type &assume_value() const &noexcept
     {
+      this->_observe_value();
       NoValuePolicy::narrow_value_check(static_cast<const basic_result_value_observers &>(*this));
       return this->_state._value;  // NOLINT
     }
     /// \group assume_value
-    constexpr value_type &&assume_value() && noexcept
+    constexpr OUTCOME_DEBUG_INLINE value_type &&assume_value() && noexcept
     {
+      this->_observe_value();
       NoValuePolicy::narrow_value_check(static_cast<basic_result_value_observers &&>(*this));
       return static_cast<value_type &&>(this->_state._value);  // NOLINT
     }
     /// \group assume_value
-    constexpr const value_type &&assume_value() const &&noexcept
+    constexpr OUTCOME_DEBUG_INLINE const value_type &&assume_value() const &&noexcept
     {
+      this->_observe_value();
       NoValuePolicy::narrow_value_check(static_cast<const basic_result_value_observers &&>(*this));
       return static_cast<const value_type &&>(this->_state._value);  // NOLINT
     }
@@ -74,44 +84,58 @@ namespace detail
     \requires The basic_result to have a successful state, else whatever `NoValuePolicy` says ought to happen.
     \group value
     */
-    constexpr value_type &value() &
+    constexpr OUTCOME_DEBUG_INLINE value_type &value() &
     {
+      this->_observe_value();
       NoValuePolicy::wide_value_check(static_cast<basic_result_value_observers &>(*this));
       return this->_state._value;  // NOLINT
     }
     /// \group value
-    constexpr const value_type &value() const &
+    constexpr OUTCOME_DEBUG_INLINE const value_type &value() const &
     {
+      this->_observe_value();
       NoValuePolicy::wide_value_check(static_cast<const basic_result_value_observers &>(*this));
-      return this->_state._value;  // NOLINT
+      return wide_const_value<NoValuePolicy>(static_cast<const basic_result_value_observers &>(*this), this->_state._value, 0);  // NOLINT
     }
     /// \group value
-    constexpr value_type &&value() &&
+    constexpr OUTCOME_DEBUG_INLINE value_type &&value() &&
     {
+      this->_observe_value();
       NoValuePolicy::wide_value_check(static_cast<basic_result_value_observers &&>(*this));
       return static_cast<value_type &&>(this->_state._value);  // NOLINT
     }
     /// \group value
-    constexpr const value_type &&value() const &&
+    constexpr OUTCOME_DEBUG_INLINE const value_type &&value() const &&
     {
+      this->_observe_value();
       NoValuePolicy::wide_value_check(static_cast<const basic_result_value_observers &&>(*this));
-      return static_cast<const value_type &&>(this->_state._value);  // NOLINT
+      return static_cast<const value_type &&>(wide_const_value<NoValuePolicy>(static_cast<const basic_result_value_observers &>(*this), this->_state._value, 0));  // NOLINT
     }
   };
-  template <class Base, class NoValuePolicy> class basic_result_value_observers<Base, void, NoValuePolicy> : public Base
+  template <class EC, class NoValuePolicy> class basic_result_value_observers<void, EC, NoValuePolicy> : public basic_result_storage<void, EC, NoValuePolicy>
   {
+    using Base = basic_result_storage<void, EC, NoValuePolicy>;
+
   public:
     using Base::Base;
 
     /// \output_section Narrow state observers
     /*! Access value without runtime checks.
     */
-    constexpr void assume_value() const noexcept { NoValuePolicy::narrow_value_check(*this); }
+    constexpr OUTCOME_DEBUG_INLINE void assume_value() const noexcept
+    {
+      this->_observe_value();
+      NoValuePolicy::narrow_value_check(*this);
+    }
     /// \output_section Wide state observers
     /*! Access value with runtime checks.
     \requires The basic_result to have a successful state, else whatever `NoValuePolicy` says ought to happen.
     */
-    constexpr void value() const { NoValuePolicy::wide_value_check(*this); }
+    constexpr OUTCOME_DEBUG_INLINE void value() const
+    {
+      this->_observe_value();
+      NoValuePolicy::wide_value_check(*this);
+    }
   };
 }  // namespace detail
 
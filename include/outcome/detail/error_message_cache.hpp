@@ -0,0 +1,200 @@
+/* Cache of interned error code messages
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_ERROR_MESSAGE_CACHE_HPP
+#define OUTCOME_ERROR_MESSAGE_CACHE_HPP
+
+#include "../config.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <system_error>
+
+#if __cplusplus >= 201700 || (defined(_MSC_VER) && _HAS_CXX17)
+#include <string_view>
+#endif
+
+#ifndef OUTCOME_ERROR_MESSAGE_CACHE_BUCKETS
+//! The number of hash buckets in the interned error message cache used by `error_message()`
+#define OUTCOME_ERROR_MESSAGE_CACHE_BUCKETS 256
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+#if __cplusplus >= 201700 || (defined(_MSC_VER) && _HAS_CXX17)
+//! The view of an interned message returned by `error_message()`.
+using error_message_view = std::string_view;
+#else
+//! The view of an interned message returned by `error_message()`, a subset of `std::string_view` before C++ 17.
+class error_message_view
+{
+  const char *_data{nullptr};
+  size_t _size{0};
+
+public:
+  constexpr error_message_view() noexcept = default;
+  constexpr error_message_view(const char *data, size_t size) noexcept
+      : _data(data)
+      , _size(size)
+  {
+  }
+  constexpr const char *data() const noexcept { return _data; }
+  constexpr size_t size() const noexcept { return _size; }
+  constexpr bool empty() const noexcept { return _size == 0; }
+  constexpr const char *begin() const noexcept { return _data; }
+  constexpr const char *end() const noexcept { return _data + _size; }
+  explicit operator std::string() const { return std::string(_data, _size); }
+  friend bool operator==(error_message_view a, error_message_view b) noexcept { return a._size == b._size && (a._size == 0 || std::memcmp(a._data, b._data, a._size) == 0); }
+  friend bool operator!=(error_message_view a, error_message_view b) noexcept { return !(a == b); }
+};
+#endif
+
+namespace detail
+{
+  /* Process wide cache of error code messages keyed by category and value, so each message is
+  generated and allocated once. Buckets are lock free lists, read with a single acquire load
+  and added to by compare and swap. Entries are never evicted nor freed.
+  */
+  class error_message_cache
+  {
+    struct _entry
+    {
+      const _entry *next;
+      const std::error_category *category;
+      int value;
+      size_t size;
+      // Followed by the null terminated message
+      const char *message() const noexcept { return reinterpret_cast<const char *>(this + 1); }  // NOLINT
+    };
+
+    std::atomic<const _entry *> _buckets[OUTCOME_ERROR_MESSAGE_CACHE_BUCKETS];
+
+    error_message_cache() noexcept
+    {
+      for(auto &i : _buckets)
+      {
+        i.store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+    static size_t _hash(const std::error_category *category, int value) noexcept { return static_cast<size_t>((reinterpret_cast<uintptr_t>(category) >> 4U) ^ (static_cast<size_t>(static_cast<unsigned>(value)) * 0x9E3779B1U)); }
+
+    static const _entry *_find(const _entry *e, const std::error_category *category, int value) noexcept
+    {
+      for(; e != nullptr; e = e->next)
+      {
+        if(e->category == category && e->value == value)
+        {
+          return e;
+        }
+      }
+      return nullptr;
+    }
+
+    static _entry *_make(const std::error_code &ec) noexcept
+    {
+#ifdef __cpp_exceptions
+      try
+      {
+#endif
+        const std::string message = ec.message();
+        void *mem = ::operator new(sizeof(_entry) + message.size() + 1, std::nothrow);
+        if(mem == nullptr)
+        {
+          return nullptr;
+        }
+        auto *e = new(mem) _entry{nullptr, &ec.category(), ec.value(), message.size()};
+        std::memcpy(const_cast<char *>(e->message()), message.c_str(), message.size() + 1);  // NOLINT
+        return e;
+#ifdef __cpp_exceptions
+      }
+      catch(...)
+      {
+        return nullptr;
+      }
+#endif
+    }
+
+    error_message_view _lookup(const std::error_code &ec) noexcept
+    {
+      const std::error_category *category = &ec.category();
+      const int value = ec.value();
+      std::atomic<const _entry *> &bucket = _buckets[_hash(category, value) % OUTCOME_ERROR_MESSAGE_CACHE_BUCKETS];
+      const _entry *head = bucket.load(std::memory_order_acquire);
+      const _entry *e = _find(head, category, value);
+      if(e == nullptr)
+      {
+        _entry *n = _make(ec);
+        if(n == nullptr)
+        {
+          return {};
+        }
+        for(;;)
+        {
+          n->next = head;
+          if(bucket.compare_exchange_weak(head, n, std::memory_order_acq_rel, std::memory_order_acquire))
+          {
+            e = n;
+            break;
+          }
+          // Another thread may have added the same message meanwhile
+          e = _find(head, category, value);
+          if(e != nullptr)
+          {
+            ::operator delete(n);
+            break;
+          }
+        }
+      }
+      return {e->message(), e->size};
+    }
+
+  public:
+    //! Returns the interned message for `ec`, creating it on first use.
+    static error_message_view get(const std::error_code &ec) noexcept
+    {
+      static error_message_cache cache;
+      return cache._lookup(ec);
+    }
+  };
+}  // namespace detail
+
+/*! Returns `ec.message()`, interned so it is generated and allocated only the first time
+each category and value is asked for. Subsequent calls are lock free and never allocate.
+\returns A view of the null terminated message which remains valid until the process exits,
+or an empty view if memory for a new message could not be allocated.
+
+Note that messages which depend on the locale are those of the locale when first asked for.
+*/
+inline error_message_view error_message(const std::error_code &ec) noexcept
+{
+  return detail::error_message_cache::get(ec);
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,160 @@
+/* Cache of exception pointers synthesised by failure()
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_FAILURE_EXCEPTION_CACHE_HPP
+#define OUTCOME_FAILURE_EXCEPTION_CACHE_HPP
+
+#include "../config.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+#ifndef OUTCOME_FAILURE_EXCEPTION_CACHE_SIZE
+//! The number of (category, value) pairs whose synthesised exception `failure()` may cache
+#define OUTCOME_FAILURE_EXCEPTION_CACHE_SIZE 64
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  /* Process wide cache of the immutable exception pointers synthesised by `failure()`,
+  keyed by error category and value, so repeated synthesis does not allocate.
+
+  `Traits` supplies `error_code`, `exception_ptr`, `from_error(ec)` making the
+  exception for an error code, `bad_alloc()` making the emergency exception,
+  `current_exception()` capturing the exception being handled and
+  `not_enough_memory()` giving the out of memory error code. Entries are
+  published lock free and never evicted nor freed. If a new entry cannot be
+  allocated, a preallocated `bad_alloc` is returned instead. If that cannot be
+  made either, the exception which prevented it is kept in its place, as the
+  cache is constructed within `noexcept` functions.
+  */
+  template <class Traits> class failure_exception_cache
+  {
+    using error_code = typename Traits::error_code;
+    using exception_ptr = typename Traits::exception_ptr;
+    static constexpr size_t _slots = OUTCOME_FAILURE_EXCEPTION_CACHE_SIZE;
+    static constexpr size_t _probes = 4;
+
+    struct _entry
+    {
+      const void *category;
+      int value;
+      exception_ptr ptr;
+    };
+
+    std::atomic<_entry *> _entries[_slots];
+    exception_ptr _bad_alloc;
+
+    failure_exception_cache() noexcept
+    {
+#ifdef __cpp_exceptions
+      try
+      {
+        _bad_alloc = Traits::bad_alloc();
+      }
+      catch(...)
+      {
+        // Most likely the bad_alloc thrown by making it
+        _bad_alloc = Traits::current_exception();
+      }
+#else
+      _bad_alloc = Traits::bad_alloc();
+#endif
+      for(auto &i : _entries)
+      {
+        i.store(nullptr, std::memory_order_relaxed);
+      }
+      // Out of memory is the one failure we cannot synthesise when it happens
+      (void) _lookup(Traits::not_enough_memory());
+    }
+
+    static size_t _hash(const void *category, int value) noexcept { return static_cast<size_t>((reinterpret_cast<uintptr_t>(category) >> 4U) ^ (static_cast<size_t>(static_cast<unsigned>(value)) * 0x9E3779B1U)); }
+
+    exception_ptr _make(const error_code &ec) const noexcept
+    {
+#ifdef __cpp_exceptions
+      try
+      {
+        return Traits::from_error(ec);
+      }
+      catch(...)
+      {
+        return _bad_alloc;
+      }
+#else
+      return Traits::from_error(ec);
+#endif
+    }
+
+    exception_ptr _lookup(const error_code &ec) noexcept
+    {
+      const void *category = &ec.category();
+      const int value = ec.value();
+      const size_t hash = _hash(category, value);
+      for(size_t n = 0; n < _probes; n++)
+      {
+        std::atomic<_entry *> &slot = _entries[(hash + n) % _slots];
+        _entry *e = slot.load(std::memory_order_acquire);
+        if(e == nullptr)
+        {
+          exception_ptr ptr = _make(ec);
+          e = new(std::nothrow) _entry{category, value, ptr};
+          if(e == nullptr)
+          {
+            return ptr;
+          }
+          _entry *expected = nullptr;
+          if(slot.compare_exchange_strong(expected, e, std::memory_order_acq_rel, std::memory_order_acquire))
+          {
+            return e->ptr;
+          }
+          // Another thread filled this slot first
+          delete e;
+          e = expected;
+        }
+        if(e->category == category && e->value == value)
+        {
+          return e->ptr;
+        }
+      }
+      // Too many collisions, so don't cache
+      return _make(ec);
+    }
+
+  public:
+    //! Returns the cached exception pointer for `ec`, creating it on first use.
+    static exception_ptr get(const error_code &ec) noexcept
+    {
+      static failure_exception_cache cache;
+      return cache._lookup(ec);
+    }
+  };
+}  // namespace detail
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
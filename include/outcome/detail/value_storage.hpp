@@ -34,15 +34,30 @@ namespace detail
   using status_bitfield_type = uint32_t;
 
   // WARNING: These bits are not tracked by abi-dumper, but changing them will break ABI!
-  static constexpr status_bitfield_type status_have_value = (1U << 0U);
-  static constexpr status_bitfield_type status_have_error = (1U << 1U);
-  static constexpr status_bitfield_type status_have_exception = (1U << 2U);
-  static constexpr status_bitfield_type status_error_is_errno = (1U << 4U);  // can errno be set from this error?
-  // bit 7 unused
-  // bits 8-15 unused
+  OUTCOME_INLINE_CONSTEXPR status_bitfield_type status_have_value = (1U << 0U);
+  OUTCOME_INLINE_CONSTEXPR status_bitfield_type status_have_error = (1U << 1U);
+  OUTCOME_INLINE_CONSTEXPR status_bitfield_type status_have_exception = (1U << 2U);
+  OUTCOME_INLINE_CONSTEXPR status_bitfield_type status_error_is_errno = (1U << 4U);  // can errno be set from this error?
+  // bits 5-15 unused
   // bits 16-31 used for user supplied 16 bit value
-  static constexpr status_bitfield_type status_2byte_shift = 16;
-  static constexpr status_bitfield_type status_2byte_mask = (0xffffU << status_2byte_shift);
+  OUTCOME_INLINE_CONSTEXPR status_bitfield_type status_2byte_shift = 16;
+  OUTCOME_INLINE_CONSTEXPR status_bitfield_type status_2byte_mask = (0xffffU << status_2byte_shift);
+
+  // Whether status is one a result, or if exceptions is true an outcome, can have: no unknown bits, and either a value alone or some failure
+  inline bool status_is_valid(status_bitfield_type status, bool exceptions) noexcept
+  {
+    const status_bitfield_type known = status_have_value | status_have_error | (exceptions ? status_have_exception : 0) | status_error_is_errno | status_2byte_mask;
+    if((status & ~known) != 0)
+    {
+      return false;
+    }
+    if((status & status_error_is_errno) != 0 && (status & status_have_error) == 0)
+    {
+      return false;
+    }
+    const status_bitfield_type have = status & (status_have_value | status_have_error | status_have_exception);
+    return have == status_have_value || (have != 0 && (have & status_have_value) == 0);
+  }
 
   // Used if T is trivial
   template <class T> struct value_storage_trivial
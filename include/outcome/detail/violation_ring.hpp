@@ -0,0 +1,118 @@
+/* Lock free ring buffer of recently detected violations
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_VIOLATION_RING_HPP
+#define OUTCOME_VIOLATION_RING_HPP
+
+#include "../config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  /* Lock free ring buffer of the `Capacity` most recently reported `T`. Reporting never
+  blocks nor allocates, and older entries are overwritten once full. Each slot carries a
+  sequence number so readers can tell if an entry was overwritten while being read.
+  Writers claim a slot by advancing its sequence number, so if writers lap the ring
+  an entry is dropped rather than torn, either because a newer entry already has its
+  slot or because another writer is still writing there.
+  */
+  template <class T, size_t Capacity> class violation_ring
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+    static_assert(Capacity > 0, "Capacity must be at least one");
+    static constexpr size_t _words = (sizeof(T) + sizeof(uintptr_t) - 1) / sizeof(uintptr_t);
+    struct _slot
+    {
+      // Odd while being written, else twice one more than the entry number stored
+      std::atomic<size_t> seq{0};
+      std::atomic<uintptr_t> words[_words];
+    };
+    std::atomic<size_t> _count{0};
+    _slot _slots[Capacity]{};
+
+  public:
+    //! The number of entries which can be retrieved.
+    static constexpr size_t capacity() noexcept { return Capacity; }
+    //! The number of entries ever reported.
+    size_t count() const noexcept { return _count.load(std::memory_order_acquire); }
+
+    //! Reports an entry, which is dropped if writers have lapped the ring while it was reported.
+    void report(const T &v) noexcept
+    {
+      uintptr_t words[_words]{};
+      std::memcpy(words, &v, sizeof(T));
+      const size_t n = _count.fetch_add(1, std::memory_order_relaxed);
+      _slot &s = _slots[n % Capacity];
+      size_t seq = s.seq.load(std::memory_order_relaxed);
+      do
+      {
+        if((seq & 1) != 0 || seq > 2 * n)
+        {
+          return;
+        }
+      } while(!s.seq.compare_exchange_weak(seq, 2 * n + 1, std::memory_order_relaxed, std::memory_order_relaxed));
+      std::atomic_thread_fence(std::memory_order_release);
+      for(size_t i = 0; i < _words; i++)
+      {
+        s.words[i].store(words[i], std::memory_order_relaxed);
+      }
+      s.seq.store(2 * n + 2, std::memory_order_release);
+    }
+
+    /*! Retrieves entry number `n`, counting from zero since program start.
+    \returns False if that entry has been overwritten, or is still being written.
+    */
+    bool get(size_t n, T &out) const noexcept
+    {
+      const _slot &s = _slots[n % Capacity];
+      if(s.seq.load(std::memory_order_acquire) != 2 * n + 2)
+      {
+        return false;
+      }
+      uintptr_t words[_words];
+      for(size_t i = 0; i < _words; i++)
+      {
+        words[i] = s.words[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if(s.seq.load(std::memory_order_relaxed) != 2 * n + 2)
+      {
+        return false;
+      }
+      std::memcpy(&out, words, sizeof(T));
+      return true;
+    }
+  };
+}  // namespace detail
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -28,6 +28,9 @@ http://www.boost.org/LICENSE_1_0.txt)
 /// \file
 /// \output_name result_c
 
+#include <errno.h>
+#include <stddef.h>
+
 //! A C struct representation of `std::error_code`.
 struct cxx_error_code
 {
@@ -59,15 +62,139 @@ struct cxx_error_code
 #define CXX_RESULT(R, S) struct result_##R##_##S
 //! A reference to a previously declared struct by `CXX_DECLARE_RESULT_EC(R, RD)`
 #define CXX_RESULT_EC(R) struct result_##R##_errorcode
+//! The bit in a result struct's `flags` set when it has a valid value
+#define CXX_RESULT_FLAG_VALUE 1U
+//! The bit in a result struct's `flags` set when it has a valid error
+#define CXX_RESULT_FLAG_ERROR 2U
+//! The bit in a result struct's `flags` set when its error is an `errno` domain code
+#define CXX_RESULT_FLAG_ERROR_IS_ERRNO (1U << 4U)
 //! True if a result struct has a valid value
-#define CXX_RESULT_HAS_VALUE(r) (((r).flags & 1U) == 1U)
+#define CXX_RESULT_HAS_VALUE(r) (((r).flags & CXX_RESULT_FLAG_VALUE) == CXX_RESULT_FLAG_VALUE)
 //! True if a result struct has a valid error
-#define CXX_RESULT_HAS_ERROR(r) (((r).flags & 2U) == 2U)
+#define CXX_RESULT_HAS_ERROR(r) (((r).flags & CXX_RESULT_FLAG_ERROR) == CXX_RESULT_FLAG_ERROR)
 //! True if a result struct's `error` or `code` is an `errno` domain code suitable for setting `errno` with.
-#define CXX_RESULT_ERROR_IS_ERRNO(r) (((r).flags & (1U << 4U)) == (1U << 4U))
+#define CXX_RESULT_ERROR_IS_ERRNO(r) (((r).flags & CXX_RESULT_FLAG_ERROR_IS_ERRNO) == CXX_RESULT_FLAG_ERROR_IS_ERRNO)
 //! C11 generic selecting a result struct's `error` or `code` integer member.
 #define CXX_RESULT_ERROR(r) _Generic((r).error, struct cxx_error_code : ((struct cxx_error_code *) &(r).error)->code, default : (r).error)
 //! Convenience macro setting `errno` to a result struct's `errno` compatible error if present, or `EAGAIN` if errored but incompatible.
 #define CXX_RESULT_SET_ERRNO(r) (errno = CXX_RESULT_HAS_ERROR(r) ? (CXX_RESULT_ERROR_IS_ERRNO(r) ? CXX_RESULT_ERROR(r) : EAGAIN) : 0)
 
+/* Bulk operations over arrays of result structs, such as a batch of results returned
+from C++. They take the array as a base address, the size of each element, and the offsets
+of `flags` and `error` within it, so they work with any struct declared by `CXX_DECLARE_RESULT()`.
+The `CXX_RESULTS_*` macros work these out from a pointer to the first element.
+
+Errors are read as an `int`, which must be the error type itself or its first member, as in
+`struct cxx_error_code`.
+*/
+
+#ifndef CXX_RESULTS_BLOCK
+//! The number of results whose flags are tested together, without branching, when searching an array.
+#define CXX_RESULTS_BLOCK 16
+#endif
+
+//! The byte offset of `flags` within the result structs pointed to by `r`.
+#define CXX_RESULTS_FLAGS_OFFSET(r) ((size_t) ((const char *) &(r)->flags - (const char *) (r)))
+//! The byte offset of `error` within the result structs pointed to by `r`.
+#define CXX_RESULTS_ERROR_OFFSET(r) ((size_t) ((const char *) &(r)->error - (const char *) (r)))
+
+//! The flags of result `n` of an array.
+static inline unsigned cxx_results_flags(const void *results, size_t n, size_t stride, size_t flags_offset)
+{
+  return *(const unsigned *) ((const char *) results + n * stride + flags_offset);
+}
+//! The error of result `n` of an array, as an `errno` suitable value, or zero if it has no error.
+static inline int cxx_results_errno(const void *results, size_t n, size_t stride, size_t flags_offset, size_t error_offset)
+{
+  const unsigned flags = cxx_results_flags(results, n, stride, flags_offset);
+  const int code = *(const int *) ((const char *) results + n * stride + error_offset);
+  return ((flags & CXX_RESULT_FLAG_ERROR) == 0) ? 0 : (((flags & CXX_RESULT_FLAG_ERROR_IS_ERRNO) != 0) ? code : EAGAIN);
+}
+
+//! Returns the number of the `count` results in an array which have an error.
+static inline size_t cxx_results_count_failures(const void *results, size_t count, size_t stride, size_t flags_offset)
+{
+  size_t failures = 0, n;
+  // Branch free, so the compiler can vectorise it
+  for(n = 0; n < count; n++)
+  {
+    failures += (cxx_results_flags(results, n, stride, flags_offset) & CXX_RESULT_FLAG_ERROR) >> 1U;
+  }
+  return failures;
+}
+
+//! Returns the index of the first of the `count` results in an array which has an error, or `count` if none do.
+static inline size_t cxx_results_find_failure(const void *results, size_t count, size_t stride, size_t flags_offset)
+{
+  size_t n = 0, i;
+  // Test whole blocks without branching, then find the failure within the first failing block
+  for(; n + CXX_RESULTS_BLOCK <= count; n += CXX_RESULTS_BLOCK)
+  {
+    unsigned flags = 0;
+    for(i = 0; i < CXX_RESULTS_BLOCK; i++)
+    {
+      flags |= cxx_results_flags(results, n + i, stride, flags_offset);
+    }
+    if((flags & CXX_RESULT_FLAG_ERROR) != 0)
+    {
+      break;
+    }
+  }
+  for(; n < count; n++)
+  {
+    if((cxx_results_flags(results, n, stride, flags_offset) & CXX_RESULT_FLAG_ERROR) != 0)
+    {
+      return n;
+    }
+  }
+  return count;
+}
+
+/*! Writes the error of each of the `count` results in an array into `errnos` as for
+`CXX_RESULT_SET_ERRNO()`, that is zero for no error, the code if it is `errno` compatible,
+otherwise `EAGAIN`. Returns the number of results with an error.
+*/
+static inline size_t cxx_results_extract_errnos(int *errnos, const void *results, size_t count, size_t stride, size_t flags_offset, size_t error_offset)
+{
+  size_t failures = 0, n;
+  for(n = 0; n < count; n++)
+  {
+    errnos[n] = cxx_results_errno(results, n, stride, flags_offset, error_offset);
+    failures += (cxx_results_flags(results, n, stride, flags_offset) & CXX_RESULT_FLAG_ERROR) >> 1U;
+  }
+  return failures;
+}
+
+/*! Sets `errno` from the first of the `count` results in an array which has an error as for
+`CXX_RESULT_SET_ERRNO()`, or to zero if none do. Returns its index, or `count` if none do.
+*/
+static inline size_t cxx_results_set_errno(const void *results, size_t count, size_t stride, size_t flags_offset, size_t error_offset)
+{
+  const size_t n = cxx_results_find_failure(results, count, stride, flags_offset);
+  errno = (n == count) ? 0 : cxx_results_errno(results, n, stride, flags_offset, error_offset);
+  return n;
+}
+
+//! Returns the number of the `count` result structs at `r` which have an error.
+#define CXX_RESULTS_COUNT_FAILURES(r, count) cxx_results_count_failures((r), (count), sizeof(*(r)), CXX_RESULTS_FLAGS_OFFSET(r))
+//! Returns the index of the first of the `count` result structs at `r` which has an error, or `count` if none do.
+#define CXX_RESULTS_FIND_FAILURE(r, count) cxx_results_find_failure((r), (count), sizeof(*(r)), CXX_RESULTS_FLAGS_OFFSET(r))
+//! Writes the `errno` compatible error of each of the `count` result structs at `r` into the `int` array `errnos`, returning the number with an error.
+#define CXX_RESULTS_EXTRACT_ERRNOS(errnos, r, count) cxx_results_extract_errnos((errnos), (r), (count), sizeof(*(r)), CXX_RESULTS_FLAGS_OFFSET(r), CXX_RESULTS_ERROR_OFFSET(r))
+//! Sets `errno` from the first of the `count` result structs at `r` which has an error, returning its index or `count` if none do.
+#define CXX_RESULTS_SET_ERRNO(r, count) cxx_results_set_errno((r), (count), sizeof(*(r)), CXX_RESULTS_FLAGS_OFFSET(r), CXX_RESULTS_ERROR_OFFSET(r))
+
+#ifdef __cplusplus
+#include "../detail/value_storage.hpp"
+
+#include <system_error>
+
+// The C flags are the C++ status bits, so must change with them
+static_assert(CXX_RESULT_FLAG_VALUE == OUTCOME_V2_NAMESPACE::detail::status_have_value, "CXX_RESULT_FLAG_VALUE does not match status_have_value");
+static_assert(CXX_RESULT_FLAG_ERROR == OUTCOME_V2_NAMESPACE::detail::status_have_error, "CXX_RESULT_FLAG_ERROR does not match status_have_error");
+static_assert(CXX_RESULT_FLAG_ERROR_IS_ERRNO == OUTCOME_V2_NAMESPACE::detail::status_error_is_errno, "CXX_RESULT_FLAG_ERROR_IS_ERRNO does not match status_error_is_errno");
+static_assert(sizeof(unsigned) == sizeof(OUTCOME_V2_NAMESPACE::detail::status_bitfield_type), "flags is not the same size as the C++ status bitfield");
+static_assert(sizeof(struct cxx_error_code) == sizeof(std::error_code), "struct cxx_error_code does not have the layout of std::error_code");
+#endif
+
 #endif
@@ -37,7 +37,31 @@ namespace detail
 {
   namespace adl
   {
-    template <class DomainType> inline std::exception_ptr basic_outcome_failure_exception_from_error(const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> &sc, search_detail_adl /*unused*/)
+    /* Domain hooks making the exception for a status code without throwing it, found
+    by ADL in the namespace of the domain. Returning a null pointer declines, and the
+    code is then thrown and caught instead. Outcome supplies these for the generic
+    and POSIX domains, including erased codes from those domains.
+    */
+    template <class DomainType> inline std::exception_ptr outcome_make_exception_ptr(const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> & /*unused*/) { return {}; }
+#ifdef __cpp_exceptions
+    inline std::exception_ptr outcome_make_exception_ptr(const SYSTEM_ERROR2_NAMESPACE::generic_code &sc) { return std::make_exception_ptr(SYSTEM_ERROR2_NAMESPACE::status_error<SYSTEM_ERROR2_NAMESPACE::_generic_code_domain>(sc)); }
+    inline std::exception_ptr outcome_make_exception_ptr(const SYSTEM_ERROR2_NAMESPACE::posix_code &sc) { return std::make_exception_ptr(SYSTEM_ERROR2_NAMESPACE::status_error<SYSTEM_ERROR2_NAMESPACE::_posix_code_domain>(sc)); }
+    template <class ErasedType> inline std::exception_ptr outcome_make_exception_ptr(const SYSTEM_ERROR2_NAMESPACE::status_code<SYSTEM_ERROR2_NAMESPACE::erased<ErasedType>> &sc)
+    {
+      if(sc.domain() == SYSTEM_ERROR2_NAMESPACE::generic_code_domain)
+      {
+        return outcome_make_exception_ptr(SYSTEM_ERROR2_NAMESPACE::generic_code(static_cast<SYSTEM_ERROR2_NAMESPACE::errc>(sc.value())));
+      }
+      if(sc.domain() == SYSTEM_ERROR2_NAMESPACE::posix_code_domain)
+      {
+        return outcome_make_exception_ptr(SYSTEM_ERROR2_NAMESPACE::posix_code(static_cast<int>(sc.value())));
+      }
+      return {};
+    }
+#endif
+
+    // Boxes the exception thrown by the status code by throwing and catching it
+    template <class DomainType> inline std::exception_ptr status_code_exception_ptr_by_throw(const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> &sc)
     {
 #ifdef __cpp_exceptions
       try
@@ -48,9 +72,21 @@ namespace detail
       {
         return std::current_exception();
       }
+#else
+      (void) sc;
 #endif
       return {};
     }
+
+    template <class DomainType> inline std::exception_ptr basic_outcome_failure_exception_from_error(const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> &sc, search_detail_adl /*unused*/)
+    {
+      std::exception_ptr ret = outcome_make_exception_ptr(sc);  // ADL discovered
+      if(ret)
+      {
+        return ret;
+      }
+      return status_code_exception_ptr_by_throw(sc);
+    }
   }
 }
 
@@ -124,7 +160,7 @@ namespace experimental
       /*! Performs a wide check of state, used in the value() functions.
       \effects See description of class for effects.
       */
-      template <class Impl> static constexpr void wide_value_check(Impl &&self)
+      template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_value_check(Impl &&self)
       {
         if(!base::_has_value(static_cast<Impl &&>(self)))
         {
@@ -145,11 +181,11 @@ namespace experimental
       /*! Performs a wide check of state, used in the error() functions
       \effects TODO
       */
-      template <class Impl> static constexpr void wide_error_check(Impl &&self) { _base::narrow_error_check(static_cast<Impl &&>(self)); }
+      template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_error_check(Impl &&self) { _base::narrow_error_check(static_cast<Impl &&>(self)); }
       /*! Performs a wide check of state, used in the exception() functions
       \effects TODO
       */
-      template <class Impl> static constexpr void wide_exception_check(Impl &&self) { _base::narrow_exception_check(static_cast<Impl &&>(self)); }
+      template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_exception_check(Impl &&self) { _base::narrow_exception_check(static_cast<Impl &&>(self)); }
     };
   }  // namespace policy
 
@@ -26,6 +26,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 #define OUTCOME_STATUS_RESULT_HPP
 
 #include "../basic_result.hpp"
+#include "../policy/terminate.hpp"
 
 #include "status-code/include/system_error2.hpp"
 
@@ -58,24 +59,29 @@ namespace experimental
       /*! Performs a wide check of state, used in the value() functions.
       \effects TODO
       */
-      template <class Impl> static constexpr void wide_value_check(Impl &&self)
+      template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_value_check(Impl &&self)
       {
         if(!base::_has_value(static_cast<Impl &&>(self)))
         {
-          if(base::_has_error(static_cast<Impl &&>(self)))
-          {
+          _wide_value_failure(static_cast<Impl &&>(self));
+        }
+      }
+      //! The failure branch of `wide_value_check()`, kept out of line so callers are only a test and a jump.
+      template <class Impl> OUTCOME_COLD static void _wide_value_failure(Impl &&self)
+      {
+        if(base::_has_error(static_cast<Impl &&>(self)))
+        {
 #ifdef __cpp_exceptions
-            base::_error(static_cast<Impl &&>(self)).throw_exception();
+          base::_error(static_cast<Impl &&>(self)).throw_exception();
 #else
-            OUTCOME_THROW_EXCEPTION(wide_value_check);
+          OUTCOME_THROW_EXCEPTION(wide_value_check);
 #endif
-          }
         }
       }
       /*! Performs a wide check of state, used in the error() functions
       \effects TODO
       */
-      template <class Impl> static constexpr void wide_error_check(Impl &&self) { _base::narrow_error_check(static_cast<Impl &&>(self)); }
+      template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_error_check(Impl &&self) { _base::narrow_error_check(static_cast<Impl &&>(self)); }
     };
 
     /*! Default policy selector.
@@ -0,0 +1,80 @@
+/* Explicit instantiations of common results and outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_EXTERN_TEMPLATES_HPP
+#define OUTCOME_EXTERN_TEMPLATES_HPP
+
+#include "outcome.hpp"
+
+#include <string>
+
+/*! The value types `R` of the `result<R>` and `outcome<R>` which the compiled library
+`outcome::sl` explicitly instantiates, as a sequence of `OUTCOME_EXTERN_TEMPLATE_VALUE_TYPE(R)`.
+Linking `outcome::sl` defines this from the `OUTCOME_SL_VALUE_TYPES` cmake cache variable, so
+it always matches what the library was built with. Each `R` must be complete after including
+Outcome, and spelled without commas.
+*/
+#ifndef OUTCOME_EXTERN_TEMPLATE_VALUE_TYPES
+#define OUTCOME_EXTERN_TEMPLATE_VALUE_TYPES OUTCOME_EXTERN_TEMPLATE_VALUE_TYPE(void) OUTCOME_EXTERN_TEMPLATE_VALUE_TYPE(int) OUTCOME_EXTERN_TEMPLATE_VALUE_TYPE(std::string)
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  // The policies of result<R> and outcome<R>, spelled without commas for the macros below
+  template <class R> using extern_result_policy = policy::default_policy<R, std::error_code, void>;
+  template <class R> using extern_outcome_policy = policy::default_policy<R, std::error_code, std::exception_ptr>;
+}  // namespace detail
+
+OUTCOME_V2_NAMESPACE_END
+
+/* Explicitly instantiates basic_result_final and every layer it is assembled from, as an
+explicit instantiation of a class does not instantiate the members of its bases.
+*/
+#define OUTCOME_EXTERN_TEMPLATE_RESULT_FINAL(ext, R, NoValuePolicy)                                                                                                                                                                                                                                                            \
+  ext template class detail::basic_result_storage<R, std::error_code, NoValuePolicy>;                                                                                                                                                                                                                                          \
+  ext template class detail::basic_result_value_observers<R, std::error_code, NoValuePolicy>;                                                                                                                                                                                                                                  \
+  ext template class detail::basic_result_error_observers<R, std::error_code, NoValuePolicy>;                                                                                                                                                                                                                                  \
+  ext template class detail::basic_result_final<R, std::error_code, NoValuePolicy>;
+
+/*! Explicitly instantiates `result<R>` and `outcome<R>` within the Outcome namespace, as
+declarations if `ext` is `extern`, otherwise as definitions.
+*/
+#define OUTCOME_EXTERN_TEMPLATE_INSTANTIATE(ext, R)                                                                                                                                                                                                                                                                            \
+  OUTCOME_EXTERN_TEMPLATE_RESULT_FINAL(ext, R, detail::extern_result_policy<R>)                                                                                                                                                                                                                                                \
+  ext template class basic_result<R, std::error_code, detail::extern_result_policy<R>>;                                                                                                                                                                                                                                        \
+  OUTCOME_EXTERN_TEMPLATE_RESULT_FINAL(ext, R, detail::extern_outcome_policy<R>)                                                                                                                                                                                                                                               \
+  ext template class detail::basic_outcome_exception_observers<R, std::error_code, std::exception_ptr, detail::extern_outcome_policy<R>>;                                                                                                                                                                                      \
+  ext template class detail::basic_outcome_failure_observers<R, std::error_code, std::exception_ptr, detail::extern_outcome_policy<R>>;                                                                                                                                                                                        \
+  ext template class basic_outcome<R, std::error_code, std::exception_ptr, detail::extern_outcome_policy<R>>;
+
+// Tell every translation unit that the compiled library instantiates these, so they need not
+OUTCOME_V2_NAMESPACE_BEGIN
+#define OUTCOME_EXTERN_TEMPLATE_VALUE_TYPE(R) OUTCOME_EXTERN_TEMPLATE_INSTANTIATE(extern, R)
+OUTCOME_EXTERN_TEMPLATE_VALUE_TYPES
+#undef OUTCOME_EXTERN_TEMPLATE_VALUE_TYPE
+OUTCOME_V2_NAMESPACE_END
+
+#endif
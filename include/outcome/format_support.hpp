@@ -0,0 +1,389 @@
+/* Allocation free formatting of result and outcome
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_FORMAT_SUPPORT_HPP
+#define OUTCOME_FORMAT_SUPPORT_HPP
+
+#include "outcome.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <string>
+
+#if __cplusplus >= 201700 || (defined(_MSC_VER) && _HAS_CXX17)
+#include <charconv>
+#endif
+#if __cplusplus >= 202000 || (defined(_MSC_VER) && _HAS_CXX20)
+#if defined(__has_include)
+#if __has_include(<format>)
+#include <format>
+#endif
+#endif
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  // Copies n chars to an output iterator
+  template <class OutIt> inline OutIt format_chars(OutIt out, const char *s, size_t n)
+  {
+    for(size_t i = 0; i < n; i++)
+    {
+      *out++ = s[i];  // NOLINT
+    }
+    return out;
+  }
+  template <class OutIt, size_t N> inline OutIt format_literal(OutIt out, const char (&s)[N]) { return format_chars(out, s, N - 1); }
+
+  // Integer to decimal into [first, last), returning one past the last char written
+  template <class T> inline char *format_integer(char *first, char *last, T v) noexcept
+  {
+#ifdef __cpp_lib_to_chars
+    return std::to_chars(first, last, v).ptr;
+#else
+    using U = std::make_unsigned_t<T>;
+    U u = static_cast<U>(v);
+    if(v < 0)
+    {
+      *first++ = '-';
+      u = static_cast<U>(0 - u);
+    }
+    char digits[std::numeric_limits<U>::digits10 + 1];
+    char *p = digits + sizeof(digits);
+    do
+    {
+      *--p = static_cast<char>('0' + u % 10);
+      u = static_cast<U>(u / 10);
+    } while(u != 0);
+    const size_t n = static_cast<size_t>(digits + sizeof(digits) - p);
+    (void) last;
+    std::memcpy(first, p, n);
+    return first + n;
+#endif
+  }
+  template <class T> inline char *format_floating_point(char *first, char *last, T v) noexcept
+  {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    return std::to_chars(first, last, v).ptr;
+#else
+    const int n = snprintf(first, static_cast<size_t>(last - first), "%.*g", std::numeric_limits<T>::digits10, static_cast<double>(v));
+    return first + ((n < 0) ? 0 : n);
+#endif
+  }
+
+  // Output iterator which only counts the chars written to it
+  class format_counting_iterator
+  {
+    size_t _count{0};
+
+  public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    format_counting_iterator &operator*() noexcept { return *this; }
+    format_counting_iterator &operator++() noexcept { return *this; }
+    format_counting_iterator &operator++(int) noexcept { return *this; }
+    format_counting_iterator &operator=(char /*unused*/) noexcept
+    {
+      ++_count;
+      return *this;
+    }
+    size_t count() const noexcept { return _count; }
+  };
+  // Output iterator writing into [first, last), which drops and remembers overflow
+  class format_bounded_iterator
+  {
+    char *_p, *_last;
+    bool _overflowed{false};
+
+  public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    format_bounded_iterator(char *first, char *last) noexcept
+        : _p(first)
+        , _last(last)
+    {
+    }
+    format_bounded_iterator &operator*() noexcept { return *this; }
+    format_bounded_iterator &operator++() noexcept { return *this; }
+    format_bounded_iterator &operator++(int) noexcept { return *this; }
+    format_bounded_iterator &operator=(char c) noexcept
+    {
+      if(_p != _last)
+      {
+        *_p++ = c;
+      }
+      else
+      {
+        _overflowed = true;
+      }
+      return *this;
+    }
+    char *ptr() const noexcept { return _p; }
+    bool overflowed() const noexcept { return _overflowed; }
+  };
+}  // namespace detail
+
+/*! Customisation point for the allocation free formatting of a value, error or exception type `T`.
+Specialise it for your own types, providing
+`template <class OutIt> static OutIt format(OutIt out, const T &v)` which writes chars to
+the output iterator `out` and returns it. It must not allocate memory.
+
+Outcome provides specialisations for `bool`, `char`, integral, enumeration and floating
+point types (using `std::to_chars()` where available), C strings, `std::string`,
+`std::string_view`, and `std::error_code` and `std::error_condition`, which are formatted
+as `category name:value` because their message would allocate.
+*/
+template <class T, class Enable = void> struct chars_formatter
+{
+};
+
+namespace detail
+{
+  template <class T, class = void> struct is_chars_formattable : std::false_type
+  {
+  };
+  template <class T> struct is_chars_formattable<T, decltype((void) chars_formatter<T>::format(std::declval<format_counting_iterator>(), std::declval<const T &>()))> : std::true_type
+  {
+  };
+  // void values and errors are formatted by the caller
+  template <> struct is_chars_formattable<void_type> : std::true_type
+  {
+  };
+}  // namespace detail
+
+template <> struct chars_formatter<bool>
+{
+  template <class OutIt> static OutIt format(OutIt out, bool v) { return v ? detail::format_literal(out, "true") : detail::format_literal(out, "false"); }
+};
+template <> struct chars_formatter<char>
+{
+  template <class OutIt> static OutIt format(OutIt out, char v)
+  {
+    *out++ = v;
+    return out;
+  }
+};
+template <class T> struct chars_formatter<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value>>
+{
+  template <class OutIt> static OutIt format(OutIt out, T v)
+  {
+    char buffer[std::numeric_limits<T>::digits10 + 3];
+    return detail::format_chars(out, buffer, static_cast<size_t>(detail::format_integer(buffer, buffer + sizeof(buffer), v) - buffer));
+  }
+};
+template <class T> struct chars_formatter<T, std::enable_if_t<std::is_enum<T>::value>>
+{
+  template <class OutIt> static OutIt format(OutIt out, T v) { return chars_formatter<std::underlying_type_t<T>>::format(out, static_cast<std::underlying_type_t<T>>(v)); }
+};
+template <class T> struct chars_formatter<T, std::enable_if_t<std::is_floating_point<T>::value>>
+{
+  template <class OutIt> static OutIt format(OutIt out, T v)
+  {
+    char buffer[64];
+    return detail::format_chars(out, buffer, static_cast<size_t>(detail::format_floating_point(buffer, buffer + sizeof(buffer), v) - buffer));
+  }
+};
+template <> struct chars_formatter<const char *>
+{
+  template <class OutIt> static OutIt format(OutIt out, const char *v) { return detail::format_chars(out, v, std::strlen(v)); }
+};
+template <> struct chars_formatter<std::string>
+{
+  template <class OutIt> static OutIt format(OutIt out, const std::string &v) { return detail::format_chars(out, v.data(), v.size()); }
+};
+#if __cplusplus >= 201700 || (defined(_MSC_VER) && _HAS_CXX17)
+template <> struct chars_formatter<std::string_view>
+{
+  template <class OutIt> static OutIt format(OutIt out, std::string_view v) { return detail::format_chars(out, v.data(), v.size()); }
+};
+#endif
+template <> struct chars_formatter<std::error_code>
+{
+  template <class OutIt> static OutIt format(OutIt out, const std::error_code &v)
+  {
+    out = chars_formatter<const char *>::format(out, v.category().name());
+    *out++ = ':';
+    return chars_formatter<int>::format(out, v.value());
+  }
+};
+template <> struct chars_formatter<std::error_condition>
+{
+  template <class OutIt> static OutIt format(OutIt out, const std::error_condition &v)
+  {
+    out = chars_formatter<const char *>::format(out, v.category().name());
+    *out++ = ':';
+    return chars_formatter<int>::format(out, v.value());
+  }
+};
+
+namespace detail
+{
+  // The value, error or exception of a result or outcome, or the given placeholder where those are void
+  template <class T, class OutIt, size_t N> inline OutIt format_part(OutIt out, const T &v, const char (& /*unused*/)[N]) { return chars_formatter<T>::format(out, v); }
+  template <class OutIt, size_t N> inline OutIt format_part(OutIt out, const void_type & /*unused*/, const char (&placeholder)[N]) { return format_literal(out, placeholder); }
+  template <class Impl> inline const auto &format_error(const Impl &v, std::false_type /*void*/) noexcept { return v.assume_error(); }
+  template <class Impl> inline void_type format_error(const Impl & /*unused*/, std::true_type /*void*/) noexcept { return {}; }
+  template <class Impl> inline const auto &format_exception(const Impl &v, std::false_type /*void*/) noexcept { return v.assume_exception(); }
+  template <class Impl> inline void_type format_exception(const Impl & /*unused*/, std::true_type /*void*/) noexcept { return {}; }
+
+  template <class R, class S, class OutIt, class Impl> inline OutIt format_result(OutIt out, const Impl &v)
+  {
+    if(v.has_value())
+    {
+      out = format_part(out, v._iostreams_state()._value, "(+void)");
+    }
+    if(v.has_error())
+    {
+      out = format_part(out, format_error(v, std::is_void<S>()), "(-void)");
+    }
+    return out;
+  }
+  // Exception pointers cannot be inspected without rethrowing, which may allocate
+  template <class T> struct format_exception_type
+  {
+    using type = std::conditional_t<is_chars_formattable<T>::value, T, void_type>;
+  };
+}  // namespace detail
+
+/*! Formats a result into an output iterator without allocating memory. Format is
+`value|error`, with `(+void)` or `(-void)` for void values or errors, the same as `print()`
+except that error codes are formatted as `category name:value` rather than with their message.
+\returns The output iterator after the last char written.
+\requires That `R` and `S` are void or have a `chars_formatter`.
+*/
+OUTCOME_TEMPLATE(class OutIt, class R, class S, class P)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_chars_formattable<detail::devoid<R>>::value &&detail::is_chars_formattable<detail::devoid<S>>::value))
+inline OutIt format_to(OutIt out, const basic_result<R, S, P> &v) { return detail::format_result<R, S>(out, v); }
+/*! Formats an outcome into an output iterator without allocating memory. Format is one of:
+
+1. `value|error|exception`
+2. `{ error, exception }`
+
+Exception types without a `chars_formatter`, such as `std::exception_ptr`, are formatted
+as `(exception)` because inspecting them would need a rethrow.
+\returns The output iterator after the last char written.
+\requires That `R` and `S` are void or have a `chars_formatter`.
+*/
+OUTCOME_TEMPLATE(class OutIt, class R, class S, class P, class N)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_chars_formattable<detail::devoid<R>>::value &&detail::is_chars_formattable<detail::devoid<S>>::value))
+inline OutIt format_to(OutIt out, const basic_outcome<R, S, P, N> &v)
+{
+  const int total = static_cast<int>(v.has_value()) + static_cast<int>(v.has_error()) + static_cast<int>(v.has_exception());
+  if(total > 1)
+  {
+    out = detail::format_literal(out, "{ ");
+  }
+  out = detail::format_result<R, S>(out, v);
+  if(total > 1)
+  {
+    out = detail::format_literal(out, ", ");
+  }
+  if(v.has_exception())
+  {
+    using exception_type = typename detail::format_exception_type<detail::devoid<P>>::type;
+    out = detail::format_part(out, static_cast<const exception_type &>(detail::format_exception(v, std::integral_constant<bool, std::is_same<exception_type, detail::void_type>::value>())), "(exception)");
+  }
+  if(total > 1)
+  {
+    out = detail::format_literal(out, " }");
+  }
+  return out;
+}
+
+//! Returns the number of chars `format_to()` would write for `v`, without allocating memory.
+template <class Impl> inline auto formatted_size(const Impl &v) -> decltype(OUTCOME_V2_NAMESPACE::format_to(std::declval<detail::format_counting_iterator>(), v), size_t())
+{
+  return OUTCOME_V2_NAMESPACE::format_to(detail::format_counting_iterator(), v).count();
+}
+
+//! The result of `to_chars()`, the same as `std::to_chars_result`.
+struct to_chars_result
+{
+  //! One past the last char written.
+  char *ptr;
+  //! `errc::value_too_large` if the buffer was too small, else zero.
+  std::errc ec;
+};
+
+/*! Formats `v` into the chars `[first, last)` without allocating memory, in the format of `format_to()`.
+The output is not null terminated.
+\returns One past the last char written, and `errc::value_too_large` if the buffer was too small
+in which case the buffer holds as much of the output as fitted.
+*/
+template <class Impl> inline auto to_chars(char *first, char *last, const Impl &v) -> decltype(OUTCOME_V2_NAMESPACE::format_to(std::declval<detail::format_bounded_iterator>(), v), to_chars_result())
+{
+  const auto it = OUTCOME_V2_NAMESPACE::format_to(detail::format_bounded_iterator(first, last), v);
+  return {it.ptr(), it.overflowed() ? std::errc::value_too_large : std::errc()};
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#if defined(__cpp_lib_format) && !defined(OUTCOME_DISABLE_STD_FORMAT_SUPPORT)
+namespace std
+{
+  //! `std::format()` support for result, in the format of `format_to()`. No format specification is accepted.
+  template <class R, class S, class P> struct formatter<OUTCOME_V2_NAMESPACE::basic_result<R, S, P>, char>
+  {
+    constexpr auto parse(format_parse_context &ctx) { return ctx.begin(); }
+    template <class Context> auto format(const OUTCOME_V2_NAMESPACE::basic_result<R, S, P> &v, Context &ctx) const { return OUTCOME_V2_NAMESPACE::format_to(ctx.out(), v); }
+  };
+  //! `std::format()` support for outcome, in the format of `format_to()`. No format specification is accepted.
+  template <class R, class S, class P, class N> struct formatter<OUTCOME_V2_NAMESPACE::basic_outcome<R, S, P, N>, char>
+  {
+    constexpr auto parse(format_parse_context &ctx) { return ctx.begin(); }
+    template <class Context> auto format(const OUTCOME_V2_NAMESPACE::basic_outcome<R, S, P, N> &v, Context &ctx) const { return OUTCOME_V2_NAMESPACE::format_to(ctx.out(), v); }
+  };
+}  // namespace std
+#endif
+
+#if defined(FMT_VERSION) && !defined(OUTCOME_DISABLE_FMT_SUPPORT)
+namespace fmt
+{
+  //! {fmt} support for result, in the format of `format_to()`. Include fmt before this header. No format specification is accepted.
+  template <class R, class S, class P> struct formatter<OUTCOME_V2_NAMESPACE::basic_result<R, S, P>, char>
+  {
+    constexpr auto parse(format_parse_context &ctx) { return ctx.begin(); }
+    template <class Context> auto format(const OUTCOME_V2_NAMESPACE::basic_result<R, S, P> &v, Context &ctx) const { return OUTCOME_V2_NAMESPACE::format_to(ctx.out(), v); }
+  };
+  //! {fmt} support for outcome, in the format of `format_to()`. Include fmt before this header. No format specification is accepted.
+  template <class R, class S, class P, class N> struct formatter<OUTCOME_V2_NAMESPACE::basic_outcome<R, S, P, N>, char>
+  {
+    constexpr auto parse(format_parse_context &ctx) { return ctx.begin(); }
+    template <class Context> auto format(const OUTCOME_V2_NAMESPACE::basic_outcome<R, S, P, N> &v, Context &ctx) const { return OUTCOME_V2_NAMESPACE::format_to(ctx.out(), v); }
+  };
+}  // namespace fmt
+#endif
+
+#endif
@@ -25,12 +25,21 @@ http://www.boost.org/LICENSE_1_0.txt)
 #ifndef OUTCOME_IOSTREAM_SUPPORT_HPP
 #define OUTCOME_IOSTREAM_SUPPORT_HPP
 
+#include "detail/error_message_cache.hpp"
 #include "outcome.hpp"
 
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
-OUTCOME_V2_NAMESPACE_BEGIN
+#if __cplusplus >= 201700 || (defined(_MSC_VER) && _HAS_CXX17)
+#include <charconv>
+#include <string_view>
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
@@ -89,8 +98,14 @@ namespace detail
   }
   OUTCOME_TEMPLATE(class T)
   OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_constructible<std::error_code, T>::value))
-  inline std::string safe_message(T && /*unused*/) { return {}; }
-  inline std::string safe_message(const std::error_code &ec) { return " (" + ec.message() + ")"; }
+  inline void safe_message(std::ostream & /*unused*/, T && /*unused*/) {}
+  inline void safe_message(std::ostream &s, const std::error_code &ec)
+  {
+    const error_message_view message = error_message(ec);
+    s << " (";
+    s.write(message.data(), static_cast<std::streamsize>(message.size()));
+    s << ")";
+  }
 }  // namespace detail
 
 /*! Deserialise a result. Format is `status_unsigned [value][error]`. Spare storage is preserved.
@@ -133,7 +148,8 @@ inline std::ostream &operator<<(std::ostream &s, const result<R, S, P> &v)
   return s;
 }
 /*! Debug print a result into a form suitable for human reading. Format is `value|error`. If the
-error type is `error_code`, appends `" (ec.message())"` afterwards.
+error type is `error_code`, appends `" (ec.message())"` afterwards, using the interned
+message from `error_message()`.
 */
 template <class R, class S, class P> inline std::string print(const detail::basic_result_final<R, S, P> &v)
 {
@@ -144,7 +160,8 @@ template <class R, class S, class P> inline std::string print(const detail::basi
   }
   if(v.has_error())
   {
-    s << v.error() << detail::safe_message(v.error());
+    s << v.error();
+    detail::safe_message(s, v.error());
   }
   return s.str();
 }
@@ -160,7 +177,8 @@ template <class S, class P> inline std::string print(const detail::basic_result_
   }
   if(v.has_error())
   {
-    s << v.error() << detail::safe_message(v.error());
+    s << v.error();
+    detail::safe_message(s, v.error());
   }
   return s.str();
 }
@@ -298,6 +316,296 @@ template <class R, class S, class P, class N> inline std::string print(const out
   }
   return s.str();
 }
+/*! Customisation point for parsing a value, error or exception type `T` from the text written
+by its `operator<<`, used by `from_chars()`. Specialise it for your own types, providing
+`static const char *parse(const char *first, const char *last, T &v)` which parses from
+`[first, last)` into a default constructed `v`, returning one past the last char consumed, or
+`nullptr` if the text is not valid. Leading whitespace has already been skipped.
+
+Outcome provides specialisations for integral types and floating point types, parsed with
+`std::from_chars()` where available, `std::string` (a whitespace delimited word, as for
+`operator>>`), and `std::error_code` (`category:value` of the standard library categories).
+*/
+template <class T, class Enable = void> struct chars_parser
+{
+};
+
+namespace detail
+{
+  inline bool parse_is_space(char c) noexcept { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v'; }
+  inline const char *parse_skip_space(const char *first, const char *last) noexcept
+  {
+    while(first != last && parse_is_space(*first) && *first != '\n')
+    {
+      ++first;
+    }
+    return first;
+  }
+
+  template <class T, class = void> struct is_chars_parseable : std::false_type
+  {
+  };
+  template <class T> struct is_chars_parseable<T, decltype((void) chars_parser<T>::parse(std::declval<const char *>(), std::declval<const char *>(), std::declval<T &>()))> : std::true_type
+  {
+  };
+  template <> struct is_chars_parseable<void_type> : std::true_type
+  {
+  };
+
+  template <class T> inline const char *parse_integer(const char *first, const char *last, T &v) noexcept
+  {
+#ifdef __cpp_lib_to_chars
+    const auto r = std::from_chars(first, last, v);
+    return (r.ec == std::errc()) ? r.ptr : nullptr;
+#else
+    using U = std::make_unsigned_t<T>;
+    const bool negative = std::is_signed<T>::value && first != last && *first == '-';
+    const char *p = negative ? first + 1 : first;
+    const U limit = negative ? static_cast<U>(static_cast<U>(std::numeric_limits<T>::max()) + 1) : static_cast<U>(std::numeric_limits<T>::max());
+    U u = 0;
+    const char *digits = p;
+    for(; p != last && *p >= '0' && *p <= '9'; ++p)
+    {
+      const U d = static_cast<U>(*p - '0');
+      if(u > (limit - d) / 10)
+      {
+        return nullptr;
+      }
+      u = static_cast<U>(u * 10 + d);
+    }
+    if(p == digits)
+    {
+      return nullptr;
+    }
+    v = negative ? static_cast<T>(0 - u) : static_cast<T>(u);
+    return p;
+#endif
+  }
+  template <class T> inline const char *parse_floating_point(const char *first, const char *last, T &v) noexcept
+  {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    const auto r = std::from_chars(first, last, v);
+    return (r.ec == std::errc()) ? r.ptr : nullptr;
+#else
+    // strtod() needs a null terminated string
+    char buffer[64];
+    size_t n = 0;
+    for(; first + n != last && n < sizeof(buffer) - 1 && !parse_is_space(first[n]); n++)
+    {
+      buffer[n] = first[n];
+    }
+    buffer[n] = 0;
+    char *end = nullptr;
+    const double d = strtod(buffer, &end);
+    if(end == buffer)
+    {
+      return nullptr;
+    }
+    v = static_cast<T>(d);
+    return first + (end - buffer);
+#endif
+  }
+}  // namespace detail
+
+template <class T> struct chars_parser<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>>
+{
+  static const char *parse(const char *first, const char *last, T &v) noexcept { return detail::parse_integer(first, last, v); }
+};
+template <class T> struct chars_parser<T, std::enable_if_t<std::is_floating_point<T>::value>>
+{
+  static const char *parse(const char *first, const char *last, T &v) noexcept { return detail::parse_floating_point(first, last, v); }
+};
+template <> struct chars_parser<std::string>
+{
+  static const char *parse(const char *first, const char *last, std::string &v)
+  {
+    const char *p = first;
+    while(p != last && !detail::parse_is_space(*p))
+    {
+      ++p;
+    }
+    if(p == first)
+    {
+      return nullptr;
+    }
+    v.assign(first, p);
+    return p;
+  }
+};
+template <> struct chars_parser<std::error_code>
+{
+  static const char *parse(const char *first, const char *last, std::error_code &v) noexcept
+  {
+    const std::error_category *categories[] = {&std::generic_category(), &std::system_category(), &std::iostream_category()};
+    for(const std::error_category *category : categories)
+    {
+      const char *name = category->name();
+      const size_t len = strlen(name);
+      if(static_cast<size_t>(last - first) > len && memcmp(first, name, len) == 0 && first[len] == ':')
+      {
+        int value = 0;
+        const char *p = detail::parse_integer(first + len + 1, last, value);
+        if(p != nullptr)
+        {
+          v = std::error_code(value, *category);
+        }
+        return p;
+      }
+    }
+    return nullptr;
+  }
+};
+
+namespace detail
+{
+  template <class T> inline const char *parse_field(const char *first, const char *last, bool present, T &v)
+  {
+    if(first == nullptr || !present)
+    {
+      return first;
+    }
+    return chars_parser<T>::parse(parse_skip_space(first, last), last, v);
+  }
+  inline const char *parse_field(const char *first, const char * /*unused*/, bool /*unused*/, void_type & /*unused*/) noexcept { return first; }
+  inline const char *parse_status(const char *first, const char *last, status_bitfield_type &status) noexcept
+  {
+    first = parse_integer(parse_skip_space(first, last), last, status);
+    // operator<< always writes a space after the status
+    if(first == nullptr || first == last || *first != ' ')
+    {
+      return nullptr;
+    }
+    return first + 1;
+  }
+  template <class Impl> inline auto &parse_error(Impl &v, std::false_type /*void*/) noexcept { return v.assume_error(); }
+  template <class Impl> inline void_type parse_error(Impl & /*unused*/, std::true_type /*void*/) noexcept { return {}; }
+  template <class Impl> inline auto &parse_exception(Impl &v, std::false_type /*void*/) noexcept { return v.assume_exception(); }
+  template <class Impl> inline void_type parse_exception(Impl & /*unused*/, std::true_type /*void*/) noexcept { return {}; }
+}  // namespace detail
+
+/*! Parses a result from the text written by `operator<<`, without using iostreams or the locale.
+Parsing stops after the last field, before any newline.
+\returns One past the last char consumed, or `errc::invalid_argument` if the text is not a valid result,
+including a status a result cannot have.
+`v` is unchanged after a failure.
+\requires That `R` and `S` are void, or default constructible and have a `chars_parser`.
+*/
+OUTCOME_TEMPLATE(class R, class S, class P)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_chars_parseable<detail::devoid<R>>::value &&detail::is_chars_parseable<detail::devoid<S>>::value))
+inline OUTCOME_V2_NAMESPACE::result<const char *> from_chars(const char *first, const char *last, result<R, S, P> &v)
+{
+  detail::status_bitfield_type status = 0;
+  const char *p = detail::parse_status(first, last, status);
+  if(p != nullptr && !detail::status_is_valid(status, false))
+  {
+    return std::errc::invalid_argument;
+  }
+  // Parse into temporaries first so v is untouched by invalid text
+  detail::devoid<R> value{};
+  detail::devoid<S> error{};
+  p = detail::parse_field(p, last, (status & detail::status_have_value) != 0, value);
+  p = detail::parse_field(p, last, (status & detail::status_have_error) != 0, error);
+  if(p == nullptr)
+  {
+    return std::errc::invalid_argument;
+  }
+  auto &state = v._iostreams_state();
+  state = std::decay_t<decltype(state)>();
+  state._status = status;
+  if((status & detail::status_have_value) != 0)
+  {
+    new(&state._value) detail::devoid<R>(std::move(value));  // NOLINT
+  }
+  if((status & detail::status_have_error) != 0)
+  {
+    detail::parse_error(v, std::is_void<S>()) = std::move(error);
+  }
+  return p;
+}
+/*! Parses an outcome from the text written by `operator<<`, without using iostreams or the locale.
+Parsing stops after the last field, before any newline.
+\returns One past the last char consumed, or `errc::invalid_argument` if the text is not a valid outcome,
+including a status an outcome cannot have.
+`v` is unchanged after a failure.
+\requires That `R`, `S` and `P` are void, or default constructible and have a `chars_parser`.
+*/
+OUTCOME_TEMPLATE(class R, class S, class P, class N)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_chars_parseable<detail::devoid<R>>::value &&detail::is_chars_parseable<detail::devoid<S>>::value &&detail::is_chars_parseable<detail::devoid<P>>::value))
+inline OUTCOME_V2_NAMESPACE::result<const char *> from_chars(const char *first, const char *last, outcome<R, S, P, N> &v)
+{
+  detail::status_bitfield_type status = 0;
+  const char *p = detail::parse_status(first, last, status);
+  if(p != nullptr && !detail::status_is_valid(status, true))
+  {
+    return std::errc::invalid_argument;
+  }
+  // Parse into temporaries first so v is untouched by invalid text
+  detail::devoid<R> value{};
+  detail::devoid<S> error{};
+  detail::devoid<P> exception{};
+  p = detail::parse_field(p, last, (status & detail::status_have_value) != 0, value);
+  p = detail::parse_field(p, last, (status & detail::status_have_error) != 0, error);
+  p = detail::parse_field(p, last, (status & detail::status_have_exception) != 0, exception);
+  if(p == nullptr)
+  {
+    return std::errc::invalid_argument;
+  }
+  auto &state = v._iostreams_state();
+  state = std::decay_t<decltype(state)>();
+  state._status = status;
+  if((status & detail::status_have_value) != 0)
+  {
+    new(&state._value) detail::devoid<R>(std::move(value));  // NOLINT
+  }
+  if((status & detail::status_have_error) != 0)
+  {
+    detail::parse_error(v, std::is_void<S>()) = std::move(error);
+  }
+  if((status & detail::status_have_exception) != 0)
+  {
+    detail::parse_exception(v, std::is_void<P>()) = std::move(exception);
+  }
+  return p;
+}
+
+/*! Parses newline separated results or outcomes from `[first, last)`, such as a file of them
+written one per line with `operator<<`, into `v` one at a time, calling `f(v)` after each.
+`v` is reused for every record to avoid constructing one per record. Blank lines are skipped.
+\returns The number of records parsed, or `errc::invalid_argument` at the first line which is
+not a valid record, after calling `f` for those before it.
+*/
+template <class Impl, class F> inline OUTCOME_V2_NAMESPACE::result<size_t> from_chars_lines(const char *first, const char *last, Impl &v, F &&f)
+{
+  size_t count = 0;
+  while(first != last)
+  {
+    first = detail::parse_skip_space(first, last);
+    if(first != last && *first != '\n')
+    {
+      auto r = from_chars(first, last, v);
+      if(!r)
+      {
+        return r.error();
+      }
+      first = detail::parse_skip_space(r.value(), last);
+      if(first != last && *first != '\n')
+      {
+        return std::errc::invalid_argument;
+      }
+      f(v);
+      ++count;
+    }
+    if(first != last)
+    {
+      ++first;
+    }
+  }
+  return count;
+}
+#if __cplusplus >= 201700 || (defined(_MSC_VER) && _HAS_CXX17)
+//! \overload
+template <class Impl, class F> inline OUTCOME_V2_NAMESPACE::result<size_t> from_chars_lines(std::string_view text, Impl &v, F &&f) { return from_chars_lines(text.data(), text.data() + text.size(), v, static_cast<F &&>(f)); }
+#endif
 OUTCOME_V2_NAMESPACE_END
 
 #endif
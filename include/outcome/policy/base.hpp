@@ -52,37 +52,39 @@ namespace policy
 #endif
     }
 
+    //! The current state's status bits.
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE unsigned _status(Impl &&self) noexcept { return static_cast<unsigned>(self._state._status); }
     //! True if the current state's status has its value bit set.
-    template <class Impl> static constexpr bool _has_value(Impl &&self) noexcept { return (self._state._status & OUTCOME_V2_NAMESPACE::detail::status_have_value) != 0; }
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE bool _has_value(Impl &&self) noexcept { return (self._state._status & OUTCOME_V2_NAMESPACE::detail::status_have_value) != 0; }
     //! True if the current state's status has its error bit set.
-    template <class Impl> static constexpr bool _has_error(Impl &&self) noexcept { return (self._state._status & OUTCOME_V2_NAMESPACE::detail::status_have_error) != 0; }
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE bool _has_error(Impl &&self) noexcept { return (self._state._status & OUTCOME_V2_NAMESPACE::detail::status_have_error) != 0; }
     //! True if the current state's status has its exception bit set.
-    template <class Impl> static constexpr bool _has_exception(Impl &&self) noexcept { return (self._state._status & OUTCOME_V2_NAMESPACE::detail::status_have_exception) != 0; }
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE bool _has_exception(Impl &&self) noexcept { return (self._state._status & OUTCOME_V2_NAMESPACE::detail::status_have_exception) != 0; }
     //! True if the current state's status has its error-is-errno bit set.
-    template <class Impl> static constexpr bool _has_error_is_errno(Impl &&self) noexcept { return (self._state._status & OUTCOME_V2_NAMESPACE::detail::status_error_is_errno) != 0; }
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE bool _has_error_is_errno(Impl &&self) noexcept { return (self._state._status & OUTCOME_V2_NAMESPACE::detail::status_error_is_errno) != 0; }
 
     //! Changes the current state's status value bit.
-    template <class Impl> static constexpr void _set_value(Impl &&self, bool v) noexcept { v ? self._state._status |= OUTCOME_V2_NAMESPACE::detail::status_have_value : self._state._status &= ~OUTCOME_V2_NAMESPACE::detail::status_have_value; }
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void _set_value(Impl &&self, bool v) noexcept { v ? self._state._status |= OUTCOME_V2_NAMESPACE::detail::status_have_value : self._state._status &= ~OUTCOME_V2_NAMESPACE::detail::status_have_value; }
     //! Changes the current state's status error bit.
-    template <class Impl> static constexpr void _set_error(Impl &&self, bool v) noexcept { v ? self._state._status |= OUTCOME_V2_NAMESPACE::detail::status_have_error : self._state._status &= ~OUTCOME_V2_NAMESPACE::detail::status_have_error; }
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void _set_error(Impl &&self, bool v) noexcept { v ? self._state._status |= OUTCOME_V2_NAMESPACE::detail::status_have_error : self._state._status &= ~OUTCOME_V2_NAMESPACE::detail::status_have_error; }
     //! Changes the current state's status exception bit.
-    template <class Impl> static constexpr void _set_exception(Impl &&self, bool v) noexcept { v ? self._state._status |= OUTCOME_V2_NAMESPACE::detail::status_have_exception : self._state._status &= ~OUTCOME_V2_NAMESPACE::detail::status_have_exception; }
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void _set_exception(Impl &&self, bool v) noexcept { v ? self._state._status |= OUTCOME_V2_NAMESPACE::detail::status_have_exception : self._state._status &= ~OUTCOME_V2_NAMESPACE::detail::status_have_exception; }
     //! Changes the current state's status error-is-errno bit.
-    template <class Impl> static constexpr void _set_error_is_errno(Impl &&self, bool v) noexcept { v ? self._state._status |= OUTCOME_V2_NAMESPACE::detail::status_error_is_errno : self._state._status &= ~OUTCOME_V2_NAMESPACE::detail::status_error_is_errno; }
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void _set_error_is_errno(Impl &&self, bool v) noexcept { v ? self._state._status |= OUTCOME_V2_NAMESPACE::detail::status_error_is_errno : self._state._status &= ~OUTCOME_V2_NAMESPACE::detail::status_error_is_errno; }
 
     //! Accesses the current state's value. No checking of validity is made.
-    template <class Impl> static constexpr auto &&_value(Impl &&self) noexcept { return static_cast<Impl &&>(self)._state._value; }
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE auto &&_value(Impl &&self) noexcept { return static_cast<Impl &&>(self)._state._value; }
     //! Accesses the current state's error. No checking of validity is made.
-    template <class Impl> static constexpr auto &&_error(Impl &&self) noexcept { return static_cast<Impl &&>(self)._error; }
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE auto &&_error(Impl &&self) noexcept { return static_cast<Impl &&>(self)._error; }
 
   public:
     //! Accesses the current state's exception. No checking of validity is made.
-    template <class R, class S, class P, class NoValuePolicy, class Impl> static inline constexpr auto &&_exception(Impl &&self) noexcept;
+    template <class R, class S, class P, class NoValuePolicy, class Impl> static inline constexpr OUTCOME_DEBUG_INLINE auto &&_exception(Impl &&self) noexcept;
 
     /*! Performs a narrow check of state, used in the assume_value() functions.
     \effects None.
     */
-    template <class Impl> static constexpr void narrow_value_check(Impl &&self) noexcept
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void narrow_value_check(Impl &&self) noexcept
     {
       if(!_has_value(self))
       {
@@ -92,7 +94,7 @@ namespace policy
     /*! Performs a narrow check of state, used in the assume_error() functions
     \effects None.
     */
-    template <class Impl> static constexpr void narrow_error_check(Impl &&self) noexcept
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void narrow_error_check(Impl &&self) noexcept
     {
       if(!_has_error(self))
       {
@@ -102,7 +104,7 @@ namespace policy
     /*! Performs a narrow check of state, used in the assume_exception() functions
     \effects None.
     */
-    template <class Impl> static constexpr void narrow_exception_check(Impl &&self) noexcept
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void narrow_exception_check(Impl &&self) noexcept
     {
       if(!_has_exception(self))
       {
@@ -0,0 +1,210 @@
+/* Policies for result and outcome
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_POLICY_LOG_VIOLATIONS_HPP
+#define OUTCOME_POLICY_LOG_VIOLATIONS_HPP
+
+#include "../detail/violation_ring.hpp"
+#include "base.hpp"
+
+#include <new>
+
+#ifndef OUTCOME_WIDE_VIOLATION_BUFFER_SIZE
+//! The number of most recent violations kept by `policy::wide_violations()`.
+#define OUTCOME_WIDE_VIOLATION_BUFFER_SIZE 64
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define OUTCOME_RETURN_ADDRESS() __builtin_return_address(0)
+#define OUTCOME_FUNCTION_SIGNATURE __PRETTY_FUNCTION__
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define OUTCOME_RETURN_ADDRESS() _ReturnAddress()
+#define OUTCOME_FUNCTION_SIGNATURE __FUNCSIG__
+#else
+#define OUTCOME_RETURN_ADDRESS() nullptr
+#define OUTCOME_FUNCTION_SIGNATURE __func__
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace policy
+{
+  //! Which wide observer a violation was detected in.
+  enum class wide_check : unsigned char
+  {
+    value,
+    error,
+    exception
+  };
+
+  //! A wide access on an object without the state being accessed.
+  struct wide_violation
+  {
+    //! A compiler specific signature naming the type of `result` or `outcome` accessed. Never null.
+    const char *type{nullptr};
+    //! The address of the object accessed.
+    const void *object{nullptr};
+    //! Its status bits at the time.
+    unsigned status{0};
+    //! The observer called.
+    wide_check check{wide_check::value};
+    //! An address within the function which called the observer, if the compiler can tell.
+    const void *return_address{nullptr};
+  };
+
+  //! Lock free ring buffer of the most recent wide violations, see `detail::violation_ring`.
+  using wide_violation_buffer = OUTCOME_V2_NAMESPACE::detail::violation_ring<wide_violation, OUTCOME_WIDE_VIOLATION_BUFFER_SIZE>;
+
+  //! The process wide buffer into which `log_violations` reports violations.
+  inline wide_violation_buffer &wide_violations() noexcept
+  {
+    static wide_violation_buffer v;
+    return v;
+  }
+
+  /*! The default handler for `log_violations`, which does nothing further and
+  whose fallback value is value initialised.
+  */
+  struct default_violation_handler
+  {
+    //! Called out of line after a violation has been logged.
+    static void on_violation(const wide_violation & /*unused*/) noexcept {}
+    //! The value given to an object whose value was observed without one.
+    template <class T> static T fallback() { return T{}; }
+  };
+
+  namespace detail
+  {
+    // The signature of this function names T without needing RTTI
+    template <class T> inline const char *violation_type_name() noexcept { return OUTCOME_FUNCTION_SIGNATURE; }
+  }  // namespace detail
+
+  /*! Policy which logs every wide check violation into `wide_violations()` and carries
+  on, rather than throwing or terminating. Intended for services built without exceptions
+  which must keep running despite a bad observation, but still want to find out about it.
+
+  After logging, `Handler::on_violation(violation)` is called. If it returns:
+
+  - For a missing value, the object is given the value `Handler::fallback<value_type>()`
+  in place of its error and exception, and the value observer returns that. If the value
+  was observed through a `const` object, which cannot be changed, the object keeps its
+  failure and the observer returns a process wide `const` fallback value instead, made
+  by `Handler::fallback<value_type>()` the first time it is needed. `void` values need
+  no fallback.
+  - For a missing error or exception, the observer returns the default constructed error
+  or exception which is always present.
+
+  `Handler` defaults to `default_violation_handler`.
+
+  Can be used in both `result` and `outcome`.
+  */
+  template <class Handler = default_violation_handler> struct log_violations : base
+  {
+  private:
+    template <class Impl> static void _log(Impl &&self, wide_check check, const void *return_address) noexcept
+    {
+      wide_violation v;
+      v.type = detail::violation_type_name<std::decay_t<Impl>>();
+      v.object = static_cast<const void *>(&self);
+      v.status = base::_status(self);
+      v.check = check;
+      v.return_address = return_address;
+      wide_violations().report(v);
+      Handler::on_violation(v);
+    }
+    template <class Self, class IsConst> static void _set_fallback(Self & /*unused*/, std::true_type /*void value*/, IsConst /*unused*/) {}
+    // The object may really be const, so wide_const_value() returns a fallback instead
+    template <class Self> static void _set_fallback(Self & /*unused*/, std::false_type /*void value*/, std::true_type /*const*/) {}
+    template <class Self> static void _set_fallback(Self &self, std::false_type /*void value*/, std::false_type /*const*/)
+    {
+      using value_type = std::decay_t<decltype(base::_value(self))>;
+      new(&base::_value(self)) value_type(Handler::template fallback<value_type>());  // NOLINT
+      // The object now holds only the fallback value, so it no longer reports a failure
+      base::_set_error(self, false);
+      base::_set_error_is_errno(self, false);
+      base::_set_exception(self, false);
+      base::_set_value(self, true);
+    }
+
+  public:
+    //! The failure branch of `wide_value_check()`, kept out of line so callers are only a test and a jump.
+    template <class Impl> OUTCOME_COLD static void _wide_value_failure(Impl &&self)
+    {
+      _log(self, wide_check::value, OUTCOME_RETURN_ADDRESS());
+      _set_fallback(self, std::is_same<std::decay_t<decltype(base::_value(self))>, OUTCOME_V2_NAMESPACE::detail::void_type>(), std::is_const<std::remove_reference_t<Impl>>());
+    }
+    //! The fallback value returned by the `const` value observers of objects without a value.
+    template <class T> OUTCOME_COLD static const T &_const_fallback()
+    {
+      static const T v(Handler::template fallback<T>());
+      return v;
+    }
+    //! The failure branch of `wide_error_check()` and `wide_exception_check()`.
+    template <class Impl> OUTCOME_COLD static void _wide_failure(Impl &&self, wide_check check) noexcept { _log(self, check, OUTCOME_RETURN_ADDRESS()); }
+
+    /*! Performs a wide check of state, used in the value() functions.
+    \effects If there is no value, logs the violation, calls the handler, and gives the object its fallback value
+    unless the object is `const`.
+    */
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_value_check(Impl &&self)
+    {
+      if(!base::_has_value(static_cast<Impl &&>(self)))
+      {
+        _wide_value_failure(static_cast<Impl &&>(self));
+      }
+    }
+    /*! Chooses the value returned by the `const` value() functions, after `wide_value_check()`.
+    \returns `value` if the object has one, else the `const` fallback value.
+    */
+    template <class Impl, class T> static constexpr OUTCOME_DEBUG_INLINE const T &wide_const_value(Impl &&self, const T &value) { return base::_has_value(static_cast<Impl &&>(self)) ? value : _const_fallback<T>(); }
+    /*! Performs a wide check of state, used in the error() functions
+    \effects If there is no error, logs the violation and calls the handler.
+    */
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_error_check(Impl &&self) noexcept
+    {
+      if(!base::_has_error(static_cast<Impl &&>(self)))
+      {
+        _wide_failure(static_cast<Impl &&>(self), wide_check::error);
+      }
+    }
+    /*! Performs a wide check of state, used in the exception() functions
+    \effects If there is no exception, logs the violation and calls the handler.
+    */
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_exception_check(Impl &&self) noexcept
+    {
+      if(!base::_has_exception(static_cast<Impl &&>(self)))
+      {
+        _wide_failure(static_cast<Impl &&>(self), wide_check::exception);
+      }
+    }
+  };
+}  // namespace policy
+
+OUTCOME_V2_NAMESPACE_END
+
+#undef OUTCOME_RETURN_ADDRESS
+#undef OUTCOME_FUNCTION_SIGNATURE
+
+#endif
@@ -44,28 +44,33 @@ namespace policy
     /*! Performs a wide check of state, used in the value() functions.
     \effects See description of class for effects.
     */
-    template <class Impl> static constexpr void wide_value_check(Impl &&self)
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_value_check(Impl &&self)
     {
-      if(!base::_has_value(std::forward<Impl>(self)))
+      if(!base::_has_value(static_cast<Impl &&>(self)))
       {
-        if(base::_has_exception(std::forward<Impl>(self)))
-        {
-          detail::_rethrow_exception<trait::has_exception_ptr_v<E>>{base::_exception<T, EC, E, error_code_throw_as_system_error>(std::forward<Impl>(self))};
-        }
-        if(base::_has_error(std::forward<Impl>(self)))
-        {
-          // ADL discovered
-          outcome_throw_as_system_error_with_payload(base::_error(std::forward<Impl>(self)));
-        }
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value"));
+        _wide_value_failure(static_cast<Impl &&>(self));
       }
     }
+    //! The failure branch of `wide_value_check()`, kept out of line so callers are only a test and a jump.
+    template <class Impl> OUTCOME_COLD static void _wide_value_failure(Impl &&self)
+    {
+      if(base::_has_exception(static_cast<Impl &&>(self)))
+      {
+        detail::_rethrow_exception<trait::has_exception_ptr_v<E>>{base::_exception<T, EC, E, error_code_throw_as_system_error>(static_cast<Impl &&>(self))};
+      }
+      if(base::_has_error(static_cast<Impl &&>(self)))
+      {
+        // ADL discovered
+        outcome_throw_as_system_error_with_payload(base::_error(static_cast<Impl &&>(self)));
+      }
+      OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value"));
+    }
     /*! Performs a wide check of state, used in the error() functions
     \effects If result does not have an error, it throws `bad_outcome_access`.
     */
-    template <class Impl> static constexpr void wide_error_check(Impl &&self)
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_error_check(Impl &&self)
     {
-      if(!base::_has_error(std::forward<Impl>(self)))
+      if(!base::_has_error(static_cast<Impl &&>(self)))
       {
         OUTCOME_THROW_EXCEPTION(bad_outcome_access("no error"));
       }
@@ -73,9 +78,9 @@ namespace policy
     /*! Performs a wide check of state, used in the exception() functions
     \effects If result does not have an exception, it throws `bad_outcome_access`.
     */
-    template <class Impl> static constexpr void wide_exception_check(Impl &&self)
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_exception_check(Impl &&self)
     {
-      if(!base::_has_exception(std::forward<Impl>(self)))
+      if(!base::_has_exception(static_cast<Impl &&>(self)))
       {
         OUTCOME_THROW_EXCEPTION(bad_outcome_access("no exception"));
       }
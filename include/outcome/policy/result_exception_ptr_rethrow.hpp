@@ -42,24 +42,29 @@ namespace policy
     /*! Performs a wide check of state, used in the value() functions
     \effects If result does not have a value, if it has an error it rethrows that error via `rethrow_exception()`, else it throws `bad_result_access`.
     */
-    template <class Impl> static constexpr void wide_value_check(Impl &&self)
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_value_check(Impl &&self)
     {
-      if(!base::_has_value(std::forward<Impl>(self)))
+      if(!base::_has_value(static_cast<Impl &&>(self)))
       {
-        if(base::_has_error(std::forward<Impl>(self)))
-        {
-          // ADL
-          rethrow_exception(policy::exception_ptr(base::_error(std::forward<Impl>(self))));
-        }
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no value"));
+        _wide_value_failure(static_cast<Impl &&>(self));
       }
     }
+    //! The failure branch of `wide_value_check()`, kept out of line so callers are only a test and a jump.
+    template <class Impl> OUTCOME_COLD static void _wide_value_failure(Impl &&self)
+    {
+      if(base::_has_error(static_cast<Impl &&>(self)))
+      {
+        // ADL
+        rethrow_exception(policy::exception_ptr(base::_error(static_cast<Impl &&>(self))));
+      }
+      OUTCOME_THROW_EXCEPTION(bad_result_access("no value"));
+    }
     /*! Performs a wide check of state, used in the value() functions
     \effects If result does not have a value, if it has an error it throws that error, else it throws `bad_result_access`.
     */
-    template <class Impl> static constexpr void wide_error_check(Impl &&self)
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_error_check(Impl &&self)
     {
-      if(!base::_has_error(std::forward<Impl>(self)))
+      if(!base::_has_error(static_cast<Impl &&>(self)))
       {
         OUTCOME_THROW_EXCEPTION(bad_result_access("no error"));
       }
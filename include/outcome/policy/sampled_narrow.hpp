@@ -0,0 +1,144 @@
+/* Policies for result and outcome
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_POLICY_SAMPLED_NARROW_HPP
+#define OUTCOME_POLICY_SAMPLED_NARROW_HPP
+
+#include "../detail/violation_ring.hpp"
+#include "base.hpp"
+
+#ifndef OUTCOME_SAMPLED_NARROW_INTERVAL
+//! The default number of narrow accesses per verified access for `policy::sampled_narrow`.
+#define OUTCOME_SAMPLED_NARROW_INTERVAL 1024
+#endif
+#ifndef OUTCOME_NARROW_VIOLATION_BUFFER_SIZE
+//! The number of most recent violations kept by `policy::narrow_violations()`.
+#define OUTCOME_NARROW_VIOLATION_BUFFER_SIZE 64
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace policy
+{
+  //! Which narrow observer a violation was detected in.
+  enum class narrow_check : unsigned char
+  {
+    value,
+    error,
+    exception
+  };
+
+  //! A narrow access detected on an object without the state being accessed.
+  struct narrow_violation
+  {
+    //! The address of the `result` or `outcome` accessed.
+    const void *object{nullptr};
+    //! Its status bits at the time.
+    unsigned status{0};
+    //! The observer called.
+    narrow_check check{narrow_check::value};
+  };
+
+  //! Lock free ring buffer of the most recent narrow violations, see `detail::violation_ring`.
+  using narrow_violation_buffer = OUTCOME_V2_NAMESPACE::detail::violation_ring<narrow_violation, OUTCOME_NARROW_VIOLATION_BUFFER_SIZE>;
+
+  //! The process wide buffer into which `sampled_narrow` reports violations.
+  inline narrow_violation_buffer &narrow_violations() noexcept
+  {
+    static narrow_violation_buffer v;
+    return v;
+  }
+
+  /*! Policy adapter which verifies one in every `Interval` narrow accesses on each thread,
+  reporting any violation into `narrow_violations()`. Wide checks are those of `Policy`.
+
+  Unverified narrow accesses do no checking at all, not even the optimiser hint of
+  the default narrow checks. A violating access is reported and then proceeds, which
+  remains undefined behaviour. Each instantiation has its own countdown, a plain thread
+  local, so sampling costs a decrement and a predictable branch per narrow access, and
+  types with different intervals do not disturb one another's rate.
+
+  Can be used in both `result` and `outcome`.
+  */
+  template <class Policy, unsigned Interval = OUTCOME_SAMPLED_NARROW_INTERVAL> struct sampled_narrow : Policy
+  {
+    static_assert(Interval > 0, "Interval must be at least one");
+
+  private:
+    // Narrow accesses of this instantiation remaining on this thread before the next one is verified
+    static unsigned &_countdown() noexcept
+    {
+      static OUTCOME_THREAD_LOCAL unsigned v = 0;
+      return v;
+    }
+    static bool _sample() noexcept
+    {
+      unsigned &countdown = _countdown();
+      if(countdown != 0)
+      {
+        --countdown;
+        return false;
+      }
+      countdown = Interval - 1;
+      return true;
+    }
+    template <class Impl> static void _report(Impl &&self, narrow_check check) noexcept { narrow_violations().report({static_cast<const void *>(&self), base::_status(self), check}); }
+
+  public:
+    /*! Performs a sampled narrow check of state, used in the assume_value() functions.
+    \effects One in `Interval` calls reports to `narrow_violations()` if there is no value.
+    */
+    template <class Impl> static void narrow_value_check(Impl &&self) noexcept
+    {
+      if(_sample() && !base::_has_value(self))
+      {
+        _report(self, narrow_check::value);
+      }
+    }
+    /*! Performs a sampled narrow check of state, used in the assume_error() functions.
+    \effects One in `Interval` calls reports to `narrow_violations()` if there is no error.
+    */
+    template <class Impl> static void narrow_error_check(Impl &&self) noexcept
+    {
+      if(_sample() && !base::_has_error(self))
+      {
+        _report(self, narrow_check::error);
+      }
+    }
+    /*! Performs a sampled narrow check of state, used in the assume_exception() functions.
+    \effects One in `Interval` calls reports to `narrow_violations()` if there is no exception.
+    */
+    template <class Impl> static void narrow_exception_check(Impl &&self) noexcept
+    {
+      if(_sample() && !base::_has_exception(self))
+      {
+        _report(self, narrow_check::exception);
+      }
+    }
+  };
+}  // namespace policy
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
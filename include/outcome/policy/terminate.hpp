@@ -42,7 +42,7 @@ namespace policy
     /*! Performs a wide check of state, used in the value() functions.
     \effects If result does not have a value, calls `std::terminate()`.
     */
-    template <class Impl> static constexpr void wide_value_check(Impl &&self)
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_value_check(Impl &&self)
     {
       if(!base::_has_value(static_cast<Impl &&>(self)))
       {
@@ -52,7 +52,7 @@ namespace policy
     /*! Performs a wide check of state, used in the error() functions
     \effects If result does not have an error, calls `std::terminate()`.
     */
-    template <class Impl> static constexpr void wide_error_check(Impl &&self) noexcept
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_error_check(Impl &&self) noexcept
     {
       if(!base::_has_error(static_cast<Impl &&>(self)))
       {
@@ -62,7 +62,7 @@ namespace policy
     /*! Performs a wide check of state, used in the exception() functions
     \effects If outcome does not have an exception, calls `std::terminate()`.
     */
-    template <class Impl> static constexpr void wide_exception_check(Impl &&self)
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_exception_check(Impl &&self)
     {
       if(!base::_has_exception(static_cast<Impl &&>(self)))
       {
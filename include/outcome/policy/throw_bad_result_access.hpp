@@ -41,19 +41,21 @@ namespace policy
     /*! Performs a wide check of state, used in the value() functions.
     \effects If result does not have a value, it throws `bad_result_access_with<EC>`.
     */
-    template <class Impl> static constexpr void wide_value_check(Impl &&self)
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_value_check(Impl &&self)
     {
-      if(!base::_has_value(std::forward<Impl>(self)))
+      if(!base::_has_value(static_cast<Impl &&>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_result_access_with<EC>(base::_error(std::forward<Impl>(self))));
+        _wide_value_failure(static_cast<Impl &&>(self));
       }
     }
+    //! The failure branch of `wide_value_check()`, kept out of line so callers are only a test and a jump.
+    template <class Impl> OUTCOME_COLD static void _wide_value_failure(Impl &&self) { OUTCOME_THROW_EXCEPTION(bad_result_access_with<EC>(base::_error(static_cast<Impl &&>(self)))); }
     /*! Performs a wide check of state, used in the error() functions
     \effects If result does not have an error, it throws `bad_result_access`.
     */
-    template <class Impl> static constexpr void wide_error_check(Impl &&self)
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_error_check(Impl &&self)
     {
-      if(!base::_has_error(std::forward<Impl>(self)))
+      if(!base::_has_error(static_cast<Impl &&>(self)))
       {
         OUTCOME_THROW_EXCEPTION(bad_result_access("no error"));
       }
@@ -61,9 +63,9 @@ namespace policy
     /*! Performs a wide check of state, used in the exception() functions
     \effects If result does not have an exception, it throws `bad_outcome_access`.
     */
-    template <class Impl> static constexpr void wide_exception_check(Impl &&self)
+    template <class Impl> static constexpr OUTCOME_DEBUG_INLINE void wide_exception_check(Impl &&self)
     {
-      if(!base::_has_exception(std::forward<Impl>(self)))
+      if(!base::_has_exception(static_cast<Impl &&>(self)))
       {
         OUTCOME_THROW_EXCEPTION(bad_outcome_access("no exception"));
       }
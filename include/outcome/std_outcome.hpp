@@ -26,6 +26,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 #define OUTCOME_STD_OUTCOME_HPP
 
 #include "basic_outcome.hpp"
+#include "detail/failure_exception_cache.hpp"
 #include "std_result.hpp"
 
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
@@ -34,7 +35,17 @@ namespace detail
 {
   namespace adl
   {
-    inline std::exception_ptr basic_outcome_failure_exception_from_error(const std::error_code &ec, search_detail_adl /*unused*/) { return std::make_exception_ptr(std::system_error(ec)); }
+    struct std_failure_exception_traits
+    {
+      using error_code = std::error_code;
+      using exception_ptr = std::exception_ptr;
+      static exception_ptr from_error(const error_code &ec) { return std::make_exception_ptr(std::system_error(ec)); }
+      static exception_ptr bad_alloc() { return std::make_exception_ptr(std::bad_alloc()); }
+      static exception_ptr current_exception() noexcept { return std::current_exception(); }
+      static error_code not_enough_memory() noexcept { return std::make_error_code(std::errc::not_enough_memory); }
+    };
+    // Implement the .failure() observer.
+    inline std::exception_ptr basic_outcome_failure_exception_from_error(const std::error_code &ec, search_detail_adl /*unused*/) { return failure_exception_cache<std_failure_exception_traits>::get(ec); }
   }
 }
 
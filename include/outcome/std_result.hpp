@@ -32,6 +32,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 #include "policy/fail_to_compile_observers.hpp"
 #include "policy/result_error_code_throw_as_system_error.hpp"
 #include "policy/result_exception_ptr_rethrow.hpp"
+#include "policy/terminate.hpp"
 #include "policy/throw_bad_result_access.hpp"
 
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
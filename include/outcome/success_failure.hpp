@@ -27,7 +27,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 
 #include "config.hpp"
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 /*! Type sugar for implicitly constructing a `basic_result<>` with a successful state.
 */
@@ -335,10 +335,10 @@ namespace detail
 }  // namespace detail
 
 //! True if the type is a success type
-template <class T> static constexpr bool is_success_type = detail::is_success_type<std::decay_t<T>>::value;
+template <class T> OUTCOME_INLINE_CONSTEXPR bool is_success_type = detail::is_success_type<std::decay_t<T>>::value;
 
 //! True if the type is a failure type
-template <class T> static constexpr bool is_failure_type = detail::is_failure_type<std::decay_t<T>>::value;
+template <class T> OUTCOME_INLINE_CONSTEXPR bool is_failure_type = detail::is_failure_type<std::decay_t<T>>::value;
 
 OUTCOME_V2_NAMESPACE_END
 
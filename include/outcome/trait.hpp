@@ -27,7 +27,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 
 #include "config.hpp"
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 //! Namespace for traits
 namespace trait
@@ -42,7 +42,7 @@ namespace trait
   - Is `void`, or else is an Object and is Destructible.
   */
   template <class R>                                                             //
-  static constexpr bool type_can_be_used_in_basic_result =                       //
+  OUTCOME_INLINE_CONSTEXPR bool type_can_be_used_in_basic_result =              //
   (!std::is_reference<R>::value                                                  //
    && !OUTCOME_V2_NAMESPACE::detail::is_in_place_type_t<std::decay_t<R>>::value  //
    && !is_success_type<R>                                                        //
@@ -25,6 +25,8 @@ http://www.boost.org/LICENSE_1_0.txt)
 #ifndef OUTCOME_TRY_HPP
 #define OUTCOME_TRY_HPP
 
+// An importer of the C++ module wants only the macros of this header
+#if !defined(IMPORTING_OUTCOME_MODULE)
 #include "success_failure.hpp"
 
 namespace std
@@ -36,7 +38,7 @@ namespace std
   }  // namespace experimental
 }  // namespace std
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 /*! Customisation point for changing what the `OUTCOME_TRY` macros
 do. This function defaults to returning `std::forward<T>(v).as_failure()`.
@@ -74,6 +76,7 @@ namespace detail
 }  // namespace detail
 
 OUTCOME_V2_NAMESPACE_END
+#endif  // IMPORTING_OUTCOME_MODULE
 
 //! \exclude
 #define OUTCOME_TRY_GLUE2(x, y) x##y
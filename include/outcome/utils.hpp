@@ -26,89 +26,284 @@ http://www.boost.org/LICENSE_1_0.txt)
 #define OUTCOME_UTILS_HPP
 
 #include "config.hpp"
+#include "detail/error_message_cache.hpp"
 
+#include <atomic>
+#include <cstring>
 #include <exception>
 #include <system_error>
+#include <typeinfo>
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 #ifdef __cpp_exceptions
-/*! Utility function which tries to match the exception in the pointer provided
-to an equivalent error code. Ought to work for all standard STL types.
-\param ep The pointer to an exception to convert. If matched, on exit this is
-reset to a null pointer.
-\param not_matched The error code to return if we could not match the exception.
-Note that a null pointer in returns a null error code.
+#ifndef OUTCOME_ERROR_FROM_EXCEPTION_FAST_PATH
+#if defined(__GLIBCXX__) && (defined(__GXX_RTTI) || defined(__cpp_rtti))
+//! Non-zero if `error_from_exception()` can read the dynamic type of the exception without rethrowing it.
+#define OUTCOME_ERROR_FROM_EXCEPTION_FAST_PATH 1
+#else
+#define OUTCOME_ERROR_FROM_EXCEPTION_FAST_PATH 0
+#endif
+#endif
 
-\effects Rethrows the exception in the pointer, and via a long sequence of `catch`
-clauses attempts to match the equivalent error code. If a match is found, the
-pointer is reset to null. If a match is not found, *not_matched* is returned instead
-and the pointer is left unmodified.
-*/
-inline std::error_code error_from_exception(std::exception_ptr &&ep = std::current_exception(), std::error_code not_matched = std::make_error_code(std::errc::resource_unavailable_try_again)) noexcept
+namespace detail
 {
-  if(!ep)
-  {
-    return {};
-  }
-  try
+  struct error_from_exception_mapping
   {
-    std::rethrow_exception(ep);
-  }
-  catch(const std::invalid_argument & /*unused*/)
-  {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::invalid_argument);
-  }
-  catch(const std::domain_error & /*unused*/)
-  {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::argument_out_of_domain);
-  }
-  catch(const std::length_error & /*unused*/)
+    const error_from_exception_mapping *next;
+#if defined(__GXX_RTTI) || defined(__cpp_rtti) || defined(_CPPRTTI)
+    const std::type_info *type;
+#endif
+    // Used when the dynamic type of the exception cannot be read directly
+    bool (*rethrow_matches)(const std::exception_ptr &);
+    // If set, computes the error code from the matched exception object instead of using ec
+    std::error_code (*from_object)(const void *);
+    std::error_code ec;
+  };
+  // User registered mappings, most recently registered first. Nodes are never freed.
+  inline std::atomic<const error_from_exception_mapping *> &error_from_exception_mappings() noexcept
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::argument_list_too_long);
+    static std::atomic<const error_from_exception_mapping *> v{nullptr};
+    return v;
   }
-  catch(const std::out_of_range & /*unused*/)
+  template <class Exception> inline bool error_from_exception_rethrow_matches(const std::exception_ptr &ep) noexcept
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::result_out_of_range);
+    try
+    {
+      std::rethrow_exception(ep);
+    }
+    catch(const Exception & /*unused*/)
+    {
+      return true;
+    }
+    catch(...)
+    {
+    }
+    return false;
   }
-  catch(const std::logic_error & /*unused*/) /* base class for this group */
-  {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::invalid_argument);
-  }
-  catch(const std::system_error &e) /* also catches ios::failure */
+
+  // Matches by rethrowing the exception, once per registered mapping and then through the STL types
+  inline std::error_code error_from_exception_rethrow(std::exception_ptr &ep, std::error_code not_matched) noexcept
   {
-    ep = std::exception_ptr();
-    return e.code();
+    for(const error_from_exception_mapping *m = error_from_exception_mappings().load(std::memory_order_acquire); m != nullptr; m = m->next)
+    {
+      if(m->rethrow_matches(ep))
+      {
+        ep = std::exception_ptr();
+        return m->ec;
+      }
+    }
+    try
+    {
+      std::rethrow_exception(ep);
+    }
+    catch(const std::invalid_argument & /*unused*/)
+    {
+      ep = std::exception_ptr();
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+    catch(const std::domain_error & /*unused*/)
+    {
+      ep = std::exception_ptr();
+      return std::make_error_code(std::errc::argument_out_of_domain);
+    }
+    catch(const std::length_error & /*unused*/)
+    {
+      ep = std::exception_ptr();
+      return std::make_error_code(std::errc::argument_list_too_long);
+    }
+    catch(const std::out_of_range & /*unused*/)
+    {
+      ep = std::exception_ptr();
+      return std::make_error_code(std::errc::result_out_of_range);
+    }
+    catch(const std::logic_error & /*unused*/) /* base class for this group */
+    {
+      ep = std::exception_ptr();
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+    catch(const std::system_error &e) /* also catches ios::failure */
+    {
+      ep = std::exception_ptr();
+      return e.code();
+    }
+    catch(const std::overflow_error & /*unused*/)
+    {
+      ep = std::exception_ptr();
+      return std::make_error_code(std::errc::value_too_large);
+    }
+    catch(const std::range_error & /*unused*/)
+    {
+      ep = std::exception_ptr();
+      return std::make_error_code(std::errc::result_out_of_range);
+    }
+    catch(const std::runtime_error & /*unused*/) /* base class for this group */
+    {
+      ep = std::exception_ptr();
+      return std::make_error_code(std::errc::resource_unavailable_try_again);
+    }
+    catch(const std::bad_alloc & /*unused*/)
+    {
+      ep = std::exception_ptr();
+      return std::make_error_code(std::errc::not_enough_memory);
+    }
+    catch(...)
+    {
+    }
+    return not_matched;
   }
-  catch(const std::overflow_error & /*unused*/)
+
+#if OUTCOME_ERROR_FROM_EXCEPTION_FAST_PATH
+  // The STL exception types, in the same order as the catch clauses above
+  inline const error_from_exception_mapping *error_from_exception_stl_mappings() noexcept
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::value_too_large);
+    static const error_from_exception_mapping v[] = {
+    {nullptr, &typeid(std::invalid_argument), nullptr, nullptr, std::make_error_code(std::errc::invalid_argument)},                  //
+    {nullptr, &typeid(std::domain_error), nullptr, nullptr, std::make_error_code(std::errc::argument_out_of_domain)},                //
+    {nullptr, &typeid(std::length_error), nullptr, nullptr, std::make_error_code(std::errc::argument_list_too_long)},                //
+    {nullptr, &typeid(std::out_of_range), nullptr, nullptr, std::make_error_code(std::errc::result_out_of_range)},                   //
+    {nullptr, &typeid(std::logic_error), nullptr, nullptr, std::make_error_code(std::errc::invalid_argument)},                       //
+    {nullptr, &typeid(std::system_error), nullptr, [](const void *e) { return static_cast<const std::system_error *>(e)->code(); }, {}},  //
+    {nullptr, &typeid(std::overflow_error), nullptr, nullptr, std::make_error_code(std::errc::value_too_large)},                     //
+    {nullptr, &typeid(std::range_error), nullptr, nullptr, std::make_error_code(std::errc::result_out_of_range)},                    //
+    {nullptr, &typeid(std::runtime_error), nullptr, nullptr, std::make_error_code(std::errc::resource_unavailable_try_again)},       //
+    {nullptr, &typeid(std::bad_alloc), nullptr, nullptr, std::make_error_code(std::errc::not_enough_memory)},                        //
+    {nullptr, nullptr, nullptr, nullptr, {}}                                                                                         //
+    };
+    return v;
   }
-  catch(const std::range_error & /*unused*/)
+  // Finds the first mapping whose type would catch the thrown type, without throwing
+  inline const error_from_exception_mapping *error_from_exception_lookup(const error_from_exception_mapping *head, const std::type_info *thrown, void *obj) noexcept
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::result_out_of_range);
+    for(const error_from_exception_mapping *m = head; m != nullptr; m = m->next)
+    {
+      void *adjusted = obj;
+      if(m->type->__do_catch(thrown, &adjusted, 1))
+      {
+        return m;
+      }
+    }
+    for(const error_from_exception_mapping *m = error_from_exception_stl_mappings(); m->type != nullptr; ++m)
+    {
+      void *adjusted = obj;
+      if(m->type->__do_catch(thrown, &adjusted, 1))
+      {
+        return m;
+      }
+    }
+    return nullptr;
   }
-  catch(const std::runtime_error & /*unused*/) /* base class for this group */
+  // Reads the thrown type out of the exception_ptr and resolves it through a per-thread cache
+  inline std::error_code error_from_exception_typeinfo(std::exception_ptr &ep, std::error_code not_matched) noexcept
   {
+    struct cache_t
+    {
+      const error_from_exception_mapping *head{nullptr};
+      unsigned next{0};
+      struct
+      {
+        const std::type_info *type;
+        const error_from_exception_mapping *mapping;
+      } entries[8]{};
+    };
+    static OUTCOME_THREAD_LOCAL cache_t cache;
+    const std::type_info *thrown = ep.__cxa_exception_type();
+    // libstdc++'s exception_ptr is a single pointer to the thrown object
+    static_assert(sizeof(std::exception_ptr) == sizeof(void *), "std::exception_ptr is not a single pointer");
+    void *obj = nullptr;
+    std::memcpy(&obj, &ep, sizeof(obj));
+    const error_from_exception_mapping *head = error_from_exception_mappings().load(std::memory_order_acquire);
+    if(cache.head != head)
+    {
+      // A mapping was registered since we last looked, so cached resolutions may be stale
+      cache = cache_t();
+      cache.head = head;
+    }
+    const error_from_exception_mapping *m = nullptr;
+    bool found = false;
+    for(auto &e : cache.entries)
+    {
+      if(e.type == thrown)
+      {
+        m = e.mapping;
+        found = true;
+        break;
+      }
+    }
+    if(!found)
+    {
+      m = error_from_exception_lookup(head, thrown, obj);
+      cache.entries[cache.next++ % 8] = {thrown, m};
+    }
+    if(m == nullptr)
+    {
+      return not_matched;
+    }
+    std::error_code ret = m->ec;
+    if(m->from_object != nullptr)
+    {
+      void *adjusted = obj;
+      m->type->__do_catch(thrown, &adjusted, 1);
+      ret = m->from_object(adjusted);
+    }
     ep = std::exception_ptr();
-    return std::make_error_code(std::errc::resource_unavailable_try_again);
+    return ret;
   }
-  catch(const std::bad_alloc & /*unused*/)
+#endif
+}  // namespace detail
+
+/*! Utility function which tries to match the exception in the pointer provided
+to an equivalent error code. Ought to work for all standard STL types.
+\param ep The pointer to an exception to convert. If matched, on exit this is
+reset to a null pointer.
+\param not_matched The error code to return if we could not match the exception.
+Note that a null pointer in returns a null error code.
+
+\effects Attempts to match the exception against the mappings registered with
+`register_error_from_exception()`, most recent first, and then the STL exception
+types. If a match is found, the pointer is reset to null. If a match is not found,
+*not_matched* is returned instead and the pointer is left unmodified.
+
+If `OUTCOME_ERROR_FROM_EXCEPTION_FAST_PATH` is non-zero (libstdc++ with RTTI),
+the dynamic type of the exception is read from the pointer and resolved through
+a per-thread cache without rethrowing. Otherwise the exception is rethrown and
+matched via a long sequence of `catch` clauses.
+*/
+inline std::error_code error_from_exception(std::exception_ptr &&ep = std::current_exception(), std::error_code not_matched = std::make_error_code(std::errc::resource_unavailable_try_again)) noexcept
+{
+  if(!ep)
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::not_enough_memory);
+    return {};
   }
-  catch(...)
+#if OUTCOME_ERROR_FROM_EXCEPTION_FAST_PATH
+  return detail::error_from_exception_typeinfo(ep, not_matched);
+#else
+  return detail::error_from_exception_rethrow(ep, not_matched);
+#endif
+}
+
+/*! Registers an additional mapping for `error_from_exception()`.
+\tparam Exception The exception type to match. Types derived from it also match.
+\param ec The error code to return when it matches.
+
+\effects Mappings registered later are tried first, and all registered mappings are
+tried before the STL exception types. Registration is thread safe, and mappings
+cannot be unregistered.
+\throws `std::bad_alloc` if the mapping could not be allocated.
+*/
+template <class Exception> inline void register_error_from_exception(std::error_code ec)
+{
+  auto *m = new detail::error_from_exception_mapping{nullptr,
+#if defined(__GXX_RTTI) || defined(__cpp_rtti) || defined(_CPPRTTI)
+                                                     &typeid(Exception),
+#endif
+                                                     detail::error_from_exception_rethrow_matches<Exception>, nullptr, ec};
+  auto &head = detail::error_from_exception_mappings();
+  const detail::error_from_exception_mapping *expected = head.load(std::memory_order_relaxed);
+  do
   {
-  }
-  return not_matched;
+    m->next = expected;
+  } while(!head.compare_exchange_weak(expected, m, std::memory_order_release, std::memory_order_relaxed));
 }
 
 /*! Utility function which tries to throw the equivalent STL exception type for
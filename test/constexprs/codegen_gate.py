@@ -0,0 +1,123 @@
+#!/usr/bin/python3
+# Codegen regression gate, run by the outcome-codegen-gate target of CMakeLists.txt
+#
+# Compiles each probe in this directory with each compiler at each optimisation level,
+# counts the opcodes of test1() with count_opcodes.py, and compares them against the
+# baseline stored in baselines/<compiler>-<major version>.csv. Fails if any count exceeds
+# its baseline by more than the tolerance, or any probe fails to compile. With --update,
+# writes the baselines from the counts instead.
+
+import argparse
+import csv
+import math
+import os
+import subprocess
+import sys
+
+import count_opcodes
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Compare the opcodes generated for each probe against a baseline')
+    parser.add_argument('--compiler', action='append', required=True, metavar='NAME=PATH',
+                        help='a compiler to test, e.g. gcc=/usr/bin/g++')
+    parser.add_argument('--opt', action='append', metavar='LEVEL',
+                        help='an optimisation level to test, default O2 and O3')
+    parser.add_argument('--flags', default='', help='extra compiler flags, e.g. include directories')
+    parser.add_argument('--probes', default=os.path.dirname(os.path.abspath(__file__)),
+                        help='the directory of probes, default this one')
+    parser.add_argument('--baselines', help='the directory of baselines, default baselines in the probes directory')
+    parser.add_argument('--work', default='.', help='the directory for binaries and disassembly')
+    parser.add_argument('--tolerance', type=int, default=2,
+                        help='opcodes a count may exceed its baseline by, default 2')
+    parser.add_argument('--tolerance-percent', type=float, default=10,
+                        help='percentage a count may exceed its baseline by if more, default 10')
+    parser.add_argument('--update', action='store_true', help='write the baselines rather than compare')
+    args = parser.parse_args()
+    if args.opt is None:
+        args.opt = ['O2', 'O3']
+    if args.baselines is None:
+        args.baselines = os.path.join(args.probes, 'baselines')
+    return args
+
+
+def major_version(compiler : str) -> str:
+    version = subprocess.check_output([compiler, '-dumpversion'], universal_newlines=True).strip()
+    return version.split('.')[0]
+
+
+def count(compiler : str, flags : str, opt : str, probe : str, work_file : str) -> int:
+    command = [compiler, '-std=c++14', '-DNDEBUG', '-' + opt] + flags.split() + [probe, '-o', work_file + '.out']
+    try:
+        subprocess.check_output(command, stderr=subprocess.STDOUT)
+        with open(work_file + '.S', 'wt') as oh:
+            subprocess.check_call(['objdump', '-C', '-d', work_file + '.out'], stdout=oh)
+    except subprocess.CalledProcessError as e:
+        print('[-] Error while compiling ' + probe + ': ' + (e.output.decode('utf-8') if e.output else str(e)),
+              file=sys.stderr)
+        return -1
+    ops, _ = count_opcodes.count_opcodes(work_file + '.S', 'test1')
+    return ops
+
+
+def read_baseline(path : str) -> dict:
+    baseline = {}
+    if os.path.isfile(path):
+        with open(path, 'rt', newline='') as ih:
+            for row in csv.DictReader(ih):
+                probe = row.pop('probe')
+                baseline[probe] = {opt: int(value) for opt, value in row.items() if value}
+    return baseline
+
+
+def write_baseline(path : str, opts : list, counts : dict):
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, 'wt', newline='') as oh:
+        writer = csv.writer(oh, lineterminator='\n')
+        writer.writerow(['probe'] + opts)
+        for probe in sorted(counts):
+            writer.writerow([probe] + [counts[probe][opt] for opt in opts])
+
+
+def main() -> int:
+    args = parse_args()
+    probes = sorted(f[:-4] for f in os.listdir(args.probes) if f.endswith('.cpp'))
+    os.makedirs(args.work, exist_ok=True)
+    failed = False
+    for spec in args.compiler:
+        name, _, compiler = spec.partition('=')
+        baseline_file = os.path.join(args.baselines, name + '-' + major_version(compiler) + '.csv')
+        baseline = read_baseline(baseline_file)
+        if not baseline and not args.update:
+            print('[!] No baseline ' + baseline_file + ', counting only. Create it with --update.')
+        counts = {}
+        for probe in probes:
+            counts[probe] = {}
+            for opt in args.opt:
+                work_file = os.path.join(args.work, probe + '.' + name + '.' + opt)
+                ops = count(compiler, args.flags, opt, os.path.join(args.probes, probe + '.cpp'), work_file)
+                counts[probe][opt] = ops
+                if ops < 0:
+                    print('[-] ' + name + ' ' + opt + ' ' + probe + ': no test1() found')
+                    failed = True
+                    continue
+                expected = baseline.get(probe, {}).get(opt)
+                if args.update or expected is None:
+                    print('[*] %s %s %s: %d' % (name, opt, probe, ops))
+                    continue
+                limit = expected + max(args.tolerance, int(math.ceil(expected * args.tolerance_percent / 100)))
+                if ops > limit:
+                    print('[-] %s %s %s: %d exceeds baseline %d, limit %d' % (name, opt, probe, ops, expected, limit))
+                    failed = True
+                elif ops < expected:
+                    print('[+] %s %s %s: %d improves on baseline %d' % (name, opt, probe, ops, expected))
+                else:
+                    print('[*] %s %s %s: %d, baseline %d' % (name, opt, probe, ops, expected))
+        if args.update and not failed:
+            write_baseline(baseline_file, args.opt, counts)
+            print('[*] Wrote ' + baseline_file)
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -1,4 +1,4 @@
-#include "../../include/boost/outcome.hpp"
+#include "../../include/outcome.hpp"
 
 #ifdef __GNUC__
 #define WEAK __attribute__((weak))
@@ -6,11 +6,11 @@
 #define WEAK
 #endif
 
-using namespace boost::outcome;
+using namespace OUTCOME_V2_NAMESPACE;
 extern outcome<int> unknown() WEAK;
 extern QUICKCPPLIB_NOINLINE std::exception_ptr test1()
 {
-  return unknown().get_exception();
+  return unknown().exception();
 }
 extern QUICKCPPLIB_NOINLINE void test2()
 {
@@ -1,4 +1,4 @@
-#include "../../include/boost/outcome.hpp"
+#include "../../include/outcome.hpp"
 
 #ifdef __GNUC__
 #define WEAK __attribute__((weak))
@@ -6,11 +6,12 @@
 #define WEAK
 #endif
 
-using namespace boost::outcome;
+using namespace OUTCOME_V2_NAMESPACE;
 extern outcome<int> unknown() WEAK;
 extern QUICKCPPLIB_NOINLINE outcome<int> test1()
 {
-  return unknown().next([](outcome<int> m) { return m.get()*3; });
+  outcome<int> m(unknown());
+  return m.value() * 3;
 }
 extern QUICKCPPLIB_NOINLINE void test2()
 {
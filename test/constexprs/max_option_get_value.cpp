@@ -1,4 +1,4 @@
-#include "../../include/boost/outcome.hpp"
+#include "../../include/outcome.hpp"
 
 #ifdef __GNUC__
 #define WEAK __attribute__((weak))
@@ -6,11 +6,11 @@
 #define WEAK
 #endif
 
-using namespace boost::outcome;
-extern option<int> unknown() WEAK;
+using namespace OUTCOME_V2_NAMESPACE;
+extern result<int, void> unknown() WEAK;
 extern QUICKCPPLIB_NOINLINE int test1()
 {
-  return unknown().get();
+  return unknown().value();
 }
 extern QUICKCPPLIB_NOINLINE void test2()
 {
@@ -1,4 +1,4 @@
-#include "../../include/boost/outcome.hpp"
+#include "../../include/outcome.hpp"
 
 #ifdef __GNUC__
 #define WEAK __attribute__((weak))
@@ -6,11 +6,12 @@
 #define WEAK
 #endif
 
-using namespace boost::outcome;
-extern option<int> unknown() WEAK;
-extern QUICKCPPLIB_NOINLINE option<int> test1()
+using namespace OUTCOME_V2_NAMESPACE;
+extern result<int, void> unknown() WEAK;
+extern QUICKCPPLIB_NOINLINE result<int, void> test1()
 {
-  return unknown().next([](option<int> m) { return m.get()*3; });
+  result<int, void> m(unknown());
+  return m.value() * 3;
 }
 extern QUICKCPPLIB_NOINLINE void test2()
 {
@@ -18,7 +19,7 @@ extern QUICKCPPLIB_NOINLINE void test2()
 
 int main(void)
 {
-  option<int> m(test1());
+  result<int, void> m(test1());
   test2();
   return 0;
 }
@@ -1,9 +1,9 @@
-#include "../../include/boost/outcome.hpp"
+#include "../../include/outcome.hpp"
 
 extern QUICKCPPLIB_NOINLINE void test1()
 {
-  using namespace boost::outcome;
-  outcome<int> m;
+  using namespace OUTCOME_V2_NAMESPACE;
+  outcome<int> m(success());
 }
 extern QUICKCPPLIB_NOINLINE void test2()
 {
@@ -1,11 +1,11 @@
-#include "../../include/boost/outcome.hpp"
+#include "../../include/outcome.hpp"
 
-extern QUICKCPPLIB_NOINLINE std::error_code test1(boost::outcome::error_code_extended ec)
+extern QUICKCPPLIB_NOINLINE std::error_code test1(std::error_code ec)
 {
-  using namespace boost::outcome;
+  using namespace OUTCOME_V2_NAMESPACE;
   outcome<int> m1(std::move(ec));
   outcome<int> m2(std::move(m1));
-  return m2.get_error();
+  return m2.error();
 }
 extern QUICKCPPLIB_NOINLINE void test2()
 {
@@ -14,7 +14,7 @@ extern QUICKCPPLIB_NOINLINE void test2()
 int main(void)
 {
   int ret = 0;
-  if(boost::outcome::error_code_extended() != test1(boost::outcome::error_code_extended()))
+  if(std::error_code() != test1(std::error_code()))
     ret = 1;
   test2();
   return ret;
@@ -1,11 +1,11 @@
-#include "../../include/boost/outcome.hpp"
+#include "../../include/outcome.hpp"
 
 extern QUICKCPPLIB_NOINLINE std::exception_ptr test1(std::exception_ptr ec)
 {
-  using namespace boost::outcome;
+  using namespace OUTCOME_V2_NAMESPACE;
   outcome<int> m1(std::move(ec));
   outcome<int> m2(std::move(m1));
-  return m2.get_exception();
+  return m2.exception();
 }
 extern QUICKCPPLIB_NOINLINE void test2()
 {
@@ -1,10 +1,11 @@
-#include "../../include/boost/outcome.hpp"
+#include "../../include/outcome.hpp"
 
-using namespace boost::outcome;
+using namespace OUTCOME_V2_NAMESPACE;
 
 extern QUICKCPPLIB_NOINLINE outcome<int> test1(int n)
 {
-  return outcome<int>(n).next([](outcome<int> m) { return m.get()*3; });
+  outcome<int> m(n);
+  return m.value() * 3;
 }
 extern QUICKCPPLIB_NOINLINE void test2()
 {
@@ -14,5 +15,5 @@ int main(void)
 {
   outcome<int> m(test1(5));
   test2();
-  return m.get()!=15;
+  return m.value()!=15;
 }
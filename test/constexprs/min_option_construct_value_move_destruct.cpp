@@ -1,11 +1,11 @@
-#include "../../include/boost/outcome.hpp"
+#include "../../include/outcome.hpp"
 
 extern QUICKCPPLIB_NOINLINE int test1()
 {
-  using namespace boost::outcome;
-  option<int> m1(5);
-  option<int> m2(std::move(m1));
-  return std::move(m2).get();
+  using namespace OUTCOME_V2_NAMESPACE;
+  result<int, void> m1(5);
+  result<int, void> m2(std::move(m1));
+  return std::move(m2).value();
 }
 extern QUICKCPPLIB_NOINLINE void test2()
 {
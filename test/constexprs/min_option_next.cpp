@@ -1,10 +1,11 @@
-#include "../../include/boost/outcome.hpp"
+#include "../../include/outcome.hpp"
 
-using namespace boost::outcome;
+using namespace OUTCOME_V2_NAMESPACE;
 
-extern QUICKCPPLIB_NOINLINE option<int> test1(int n)
+extern QUICKCPPLIB_NOINLINE result<int, void> test1(int n)
 {
-  return option<int>(n).next([](option<int> m) { return m.get()*3; });
+  result<int, void> m(n);
+  return m.value() * 3;
 }
 extern QUICKCPPLIB_NOINLINE void test2()
 {
@@ -12,7 +13,7 @@ extern QUICKCPPLIB_NOINLINE void test2()
 
 int main(void)
 {
-  option<int> m(test1(5));
+  result<int, void> m(test1(5));
   test2();
-  return m.get()!=15;
+  return m.value()!=15;
 }
@@ -1,10 +1,11 @@
-#include "../../include/boost/outcome.hpp"
+#include "../../include/outcome.hpp"
 
-using namespace boost::outcome;
+using namespace OUTCOME_V2_NAMESPACE;
 
 extern QUICKCPPLIB_NOINLINE result<int> test1(int n)
 {
-  return result<int>(n).next([](result<int> m) { return m.get()*3; });
+  result<int> m(n);
+  return m.value() * 3;
 }
 extern QUICKCPPLIB_NOINLINE void test2()
 {
@@ -14,5 +15,5 @@ int main(void)
 {
   result<int> m(test1(5));
   test2();
-  return m.get()!=15;
+  return m.value()!=15;
 }
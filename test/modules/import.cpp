@@ -0,0 +1,114 @@
+/* Unit testing for outcomes imported as a C++ module
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+// An importer gets nothing from the standard library through the module
+#include <cstdio>
+#include <exception>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+// With OUTCOME_ENABLE_CXX_MODULES defined this imports outcome_v2_0, then defines the macros
+#include "../../include/outcome.hpp"
+
+#ifndef OUTCOME_V2_NAMESPACE
+#error The macros of Outcome should be defined by outcome.hpp after importing the module
+#endif
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+static int failures;
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, "FAIL: %s at line %d\n", #expr, __LINE__);                                                                                                                                                                                                                                                                 \
+    ++failures;                                                                                                                                                                                                                                                                                                                \
+  }
+
+static outcome::result<int> half(int x)
+{
+  if(x % 2 != 0)
+  {
+    return std::errc::invalid_argument;
+  }
+  return x / 2;
+}
+
+static outcome::result<int> quarter(int x)
+{
+  OUTCOME_TRY(h, half(x));
+  return half(h);
+}
+
+static outcome::outcome<int> throws(int x)
+{
+  try
+  {
+    throw std::runtime_error(std::to_string(x));
+  }
+  catch(...)
+  {
+    return outcome::error_from_exception();
+  }
+}
+
+int main()
+{
+  // result, its constructors and observers
+  CHECK(quarter(8).value() == 2);
+  CHECK(quarter(6).error() == std::errc::invalid_argument);
+  CHECK(!quarter(6).has_value());
+  outcome::result<int> a(outcome::in_place_type<int>, 5);
+  CHECK(a.value() == 5);
+  outcome::result<void> b(outcome::success());
+  CHECK(b.has_value());
+  outcome::unchecked<int, long> c(outcome::failure(5L));
+  CHECK(c.error() == 5L);
+
+  // outcome, including the exception slot
+  outcome::outcome<int> d(outcome::success(7));
+  CHECK(d.value() == 7);
+  outcome::outcome<int> e(throws(3));
+  CHECK(e.has_failure());
+  CHECK(e.has_error() || e.has_exception());
+  outcome::outcome<int> f(std::make_exception_ptr(std::runtime_error("f")));
+  CHECK(f.has_exception());
+
+  // Comparison and conversion between result and outcome
+  CHECK(a == outcome::success(5));
+  CHECK(outcome::outcome<int>(a).value() == 5);
+
+  // iostream support
+  std::stringstream ss;
+  ss << outcome::print(a);
+  CHECK(ss.str() == "5");
+
+  if(failures != 0)
+  {
+    fprintf(stderr, "%d checks failed\n", failures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
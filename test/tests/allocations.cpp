@@ -0,0 +1,225 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/format_support.hpp"
+#include "../../include/outcome/iostream_support.hpp"
+#include "../../include/outcome/outcome.hpp"
+#include "../../include/outcome/try.hpp"
+#include "../../include/outcome/utils.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+/* Replaces the global allocation functions with ones counting allocations per thread. The
+default array and nothrow forms call these, so they get counted too. malloc() itself is not
+interposed, as that cannot be done portably, but nothing in Outcome calls it directly.
+*/
+namespace allocation_counting
+{
+  static thread_local size_t allocations;  // NOLINT
+
+  template <class F> inline size_t count_allocations(F &&f)
+  {
+    size_t before = allocations;
+    f();
+    return allocations - before;
+  }
+}  // namespace allocation_counting
+
+// GCC pairs the free() below with the replaced operator new, and warns they mismatch
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void *operator new(size_t bytes)
+{
+  ++allocation_counting::allocations;
+  void *ret = malloc(bytes != 0 ? bytes : 1);  // NOLINT
+  if(ret == nullptr)
+  {
+#ifdef __cpp_exceptions
+    throw std::bad_alloc();
+#else
+    abort();
+#endif
+  }
+  return ret;
+}
+void operator delete(void *p) noexcept
+{
+  free(p);  // NOLINT
+}
+void operator delete(void *p, size_t /*unused*/) noexcept
+{
+  free(p);  // NOLINT
+}
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+namespace allocation_counting
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+
+  template <class T> inline result<T> propagate_result(result<T> r)
+  {
+    OUTCOME_TRY(v, std::move(r));
+    return std::move(v);
+  }
+  template <class T> inline outcome<T> propagate_outcome(result<T> r)
+  {
+    OUTCOME_TRY(v, std::move(r));
+    return std::move(v);
+  }
+
+  // Everything here ought to never touch the heap
+  template <class T> inline void check_no_allocations(const char *name, const T &value)
+  {
+    // Make the inputs before counting, as copying them may allocate
+    const std::error_code ec = make_error_code(std::errc::invalid_argument);
+    T v1(value), v2(value), v3(value), v4(value);
+    size_t count = count_allocations([&] {
+      // Construction
+      result<T> a(std::move(v1));
+      result<T> b(ec);
+      result<T> c(success(std::move(v2)));
+      result<T> d(failure(ec));
+      outcome<T> e(std::move(v3));
+      outcome<T> f(ec);
+      // Move
+      result<T> g(std::move(a));
+      outcome<T> h(std::move(e));
+      a = std::move(g);
+      e = std::move(h);
+      // Conversion
+      outcome<T> i(std::move(b));
+      // TRY propagation
+      auto j = propagate_result(std::move(c));
+      auto k = propagate_result(std::move(d));
+      auto l = propagate_outcome(std::move(k));
+      BOOST_CHECK(j.has_value());
+      BOOST_CHECK(l.has_error());
+      // as_failure()
+      result<T> m(k.as_failure());
+      outcome<T> n(f.as_failure());
+      BOOST_CHECK(m.has_error());
+      BOOST_CHECK(n.has_error());
+      // Comparison
+      BOOST_CHECK(a != m);
+      BOOST_CHECK(m == k);
+      BOOST_CHECK(m == failure(ec));
+      BOOST_CHECK(f == n);
+      BOOST_CHECK(e != n);
+      // Swap
+      swap(a, m);
+      swap(e, n);
+      BOOST_CHECK(a.has_error());
+      BOOST_CHECK(e.has_error());
+      outcome<T> o(std::move(v4));
+      o.swap(e);
+      BOOST_CHECK(o.has_error());
+    });
+    BOOST_CHECK(count == 0);
+    std::cout << "Allocations for hot paths of result<" << name << "> and outcome<" << name << ">: " << count << std::endl;
+  }
+}  // namespace allocation_counting
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / allocations, "Tests that result and outcome hot paths never allocate memory")
+{
+  using namespace allocation_counting;
+  check_no_allocations<int>("int", 5);
+  check_no_allocations<std::string>("std::string", "a string long enough to defeat the small string optimisation");
+  check_no_allocations<std::vector<int>>("std::vector<int>", {1, 2, 3, 4, 5});
+
+  // Formatting into a caller supplied buffer, unlike print(), never allocates
+  using namespace OUTCOME_V2_NAMESPACE;
+  result<double> a(1.5), b(make_error_code(std::errc::invalid_argument));
+  outcome<std::string> c(std::string("a string long enough to defeat the small string optimisation"));
+  char buffer[128];
+  // As does fetching the message of an error code, once it has been interned
+  (void) error_message(b.error());
+  BOOST_CHECK(count_allocations([&] { (void) error_message(b.error()); }) == 0);
+  BOOST_CHECK(count_allocations([&] {
+                (void) formatted_size(a);
+                (void) to_chars(buffer, buffer + sizeof(buffer), a);
+                (void) formatted_size(b);
+                (void) to_chars(buffer, buffer + sizeof(buffer), b);
+                (void) formatted_size(c);
+                (void) to_chars(buffer, buffer + sizeof(buffer), c);
+              }) == 0);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / allocating, "Reports the allocations of result and outcome paths which do allocate memory")
+{
+  using namespace allocation_counting;
+  const std::error_code ec = make_error_code(std::errc::invalid_argument);
+  {
+    result<int> a(5), b(ec);
+    size_t count = count_allocations([&] { (void) print(a); });
+    std::cout << "Allocations for print() of a valued result<int>: " << count << std::endl;
+    count = count_allocations([&] { (void) print(b); });
+    std::cout << "Allocations for print() of an errored result<int>: " << count << std::endl;
+  }
+#ifdef __cpp_exceptions
+  {
+    outcome<int> a(ec);
+    size_t count = count_allocations([&] { (void) a.failure(); });
+    std::cout << "Allocations for first failure() synthesis of an errored outcome<int>: " << count << std::endl;
+    // Once synthesised, the exception is cached
+    BOOST_CHECK(count_allocations([&] { (void) a.failure(); }) == 0);
+    BOOST_CHECK(a.failure() == a.failure());
+    // Out of memory must never need memory
+    outcome<int> b(std::make_error_code(std::errc::not_enough_memory));
+    BOOST_CHECK(count_allocations([&] { (void) b.failure(); }) == 0);
+    try
+    {
+      std::rethrow_exception(b.failure());
+    }
+    catch(const std::system_error &e)
+    {
+      BOOST_CHECK(e.code() == std::errc::not_enough_memory);
+    }
+  }
+  {
+    // Making the emergency exception may itself run out of memory, which must not terminate
+    struct traits : OUTCOME_V2_NAMESPACE::detail::adl::std_failure_exception_traits
+    {
+      static exception_ptr bad_alloc() { throw std::bad_alloc(); }
+      static exception_ptr from_error(const error_code & /*unused*/) { throw std::bad_alloc(); }
+    };
+    std::exception_ptr e = OUTCOME_V2_NAMESPACE::detail::failure_exception_cache<traits>::get(ec);
+    try
+    {
+      std::rethrow_exception(e);
+    }
+    catch(const std::bad_alloc & /*unused*/)
+    {
+      BOOST_CHECK(true);
+    }
+  }
+#endif
+}
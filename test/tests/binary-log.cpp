@@ -0,0 +1,98 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/binary_log.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <cstdio>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / binary_log, "Tests that binary logs can be mapped, walked and seeked")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static constexpr size_t records = 3 * OUTCOME_BINARY_LOG_INDEX_STRIDE + 7;
+  static const char path[] = "outcome_binary_log_test.bin";
+
+  // Write a log where every fifth record is failed
+  {
+    std::vector<unsigned char> buffer;
+    for(size_t n = 0; n < records; n++)
+    {
+      result<std::string> r = (n % 5 == 4) ? result<std::string>(std::errc::invalid_argument) : result<std::string>(std::to_string(n));
+      const size_t offset = buffer.size();
+      buffer.resize(offset + binary_log_size(r));
+      BOOST_REQUIRE(binary_log_encode(buffer.data() + offset, buffer.size() - offset, r).value() == buffer.size() - offset);
+    }
+    // Followed by a partially written record, as if the writer died
+    buffer.push_back(100);
+    buffer.push_back(0);
+    buffer.push_back(0);
+    buffer.push_back(0);
+    buffer.push_back(binary_format_version);
+    FILE *f = fopen(path, "wb");
+    BOOST_REQUIRE(f != nullptr);
+    BOOST_REQUIRE(fwrite(buffer.data(), 1, buffer.size(), f) == buffer.size());
+    fclose(f);
+  }
+
+  {
+    auto mapping = binary_log_mapping::map(path);
+    BOOST_REQUIRE(mapping.has_value());
+    binary_log_reader reader(mapping.value());
+
+    // Walk the whole log, decoding into the same result each time
+    size_t n = 0;
+    result<std::string> r(std::errc::invalid_argument);
+    for(binary_log_record record : reader)
+    {
+      BOOST_CHECK(record.has_error() == (n % 5 == 4));
+      BOOST_REQUIRE(record.decode(r).has_value());
+      if(n % 5 == 4)
+      {
+        BOOST_CHECK(r.error() == std::errc::invalid_argument);
+      }
+      else
+      {
+        BOOST_CHECK(r.value() == std::to_string(n));
+      }
+      ++n;
+    }
+    BOOST_CHECK(n == records);
+
+    // Seek forwards, backwards and off the end
+    for(size_t i : {records - 1, size_t(0), size_t(OUTCOME_BINARY_LOG_INDEX_STRIDE + 3), size_t(OUTCOME_BINARY_LOG_INDEX_STRIDE + 1), size_t(8)})
+    {
+      auto it = reader.seek(i);
+      BOOST_REQUIRE(it != reader.end());
+      BOOST_REQUIRE((*it).decode(r).has_value());
+      BOOST_CHECK(r.value() == std::to_string(i));
+    }
+    BOOST_CHECK(reader.seek(records) == reader.end());
+    BOOST_CHECK(reader.seek(records * 2) == reader.end());
+  }
+  remove(path);
+
+  BOOST_CHECK(binary_log_mapping::map(path).error() == std::errc::no_such_file_or_directory);
+  binary_log_reader empty(nullptr, 0);
+  BOOST_CHECK(empty.begin() == empty.end());
+  BOOST_CHECK(empty.seek(0) == empty.end());
+}
@@ -0,0 +1,141 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/binary_support.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+namespace binary_serialisation_test
+{
+  struct point
+  {
+    int x, y;
+  };
+  class test_category_impl : public std::error_category
+  {
+  public:
+    const char *name() const noexcept override { return "binary serialisation test"; }
+    std::string message(int c) const override { return std::to_string(c); }
+  };
+  inline const std::error_category &test_category()
+  {
+    static test_category_impl v;
+    return v;
+  }
+  inline const std::error_category &other_category()
+  {
+    static test_category_impl v;
+    return v;
+  }
+}  // namespace binary_serialisation_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / binary_serialisation, "Tests that result and outcome binary serialise and deserialise as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace binary_serialisation_test;
+  unsigned char buffer[256];
+
+  // The layout is fixed little endian
+  result<uint32_t> a(0x01020304U);
+  BOOST_CHECK(binary_size(a) == 9);
+  BOOST_REQUIRE(binary_encode(buffer, sizeof(buffer), a).value() == 9);
+  const unsigned char expected[] = {binary_format_version, 1, 0, 0, 0, 4, 3, 2, 1};
+  BOOST_CHECK(memcmp(buffer, expected, sizeof(expected)) == 0);
+  result<uint32_t> b(std::errc::invalid_argument);
+  BOOST_CHECK(binary_decode(buffer, 9, b).value() == 9);
+  BOOST_CHECK(b == a);
+
+  // Errors round trip through the category registry
+  result<double> c(std::errc::no_such_file_or_directory);
+  BOOST_CHECK(binary_size(c) == 13);
+  BOOST_REQUIRE(binary_encode(buffer, sizeof(buffer), c).value() == 13);
+  result<double> d(1.5);
+  BOOST_CHECK(binary_decode(buffer, 13, d).value() == 13);
+  BOOST_CHECK(d.error() == std::errc::no_such_file_or_directory);
+  BOOST_CHECK(&d.error().category() == &std::generic_category());
+  result<double> e(std::error_code(5, test_category()));
+  BOOST_CHECK(binary_encode(buffer, sizeof(buffer), e).error() == std::errc::not_supported);
+  BOOST_CHECK(register_binary_error_category(test_category(), 0).error() == std::errc::invalid_argument);    // never valid
+  BOOST_CHECK(register_binary_error_category(test_category(), 255).error() == std::errc::invalid_argument);  // reserved
+  BOOST_CHECK(binary_error_category_id(test_category()) == 0);
+  BOOST_CHECK(register_binary_error_category(test_category(), 1000).has_value());
+  BOOST_CHECK(binary_error_category_id(test_category()) == 1000);
+  BOOST_CHECK(register_binary_error_category(test_category(), 1001).error() == std::errc::invalid_argument);          // category already registered
+  BOOST_CHECK(register_binary_error_category(other_category(), 1000).error() == std::errc::invalid_argument);         // id already registered
+  BOOST_CHECK(register_binary_error_category(std::generic_category(), 1002).error() == std::errc::invalid_argument);  // preregistered
+  BOOST_CHECK(binary_error_category(1000) == &test_category());
+  BOOST_CHECK(binary_error_category(1001) == nullptr);
+  BOOST_REQUIRE(binary_encode(buffer, sizeof(buffer), e).has_value());
+  BOOST_CHECK(binary_decode(buffer, 13, d).has_value());
+  BOOST_CHECK(d == e);
+
+  // Trivially copyable, string and void values
+  result<point> f(point{3, 4});
+  BOOST_REQUIRE(binary_encode(buffer, sizeof(buffer), f).value() == 5 + sizeof(point));
+  result<point> g(std::errc::invalid_argument);
+  BOOST_CHECK(binary_decode(buffer, sizeof(buffer), g).value() == 5 + sizeof(point));
+  BOOST_CHECK(g.value().x == 3 && g.value().y == 4);
+  result<std::string> h("niall");
+  BOOST_REQUIRE(binary_encode(buffer, sizeof(buffer), h).value() == 14);
+  result<std::string> i(std::errc::invalid_argument);
+  BOOST_CHECK(binary_decode(buffer, 14, i).value() == 14);
+  BOOST_CHECK(i.value() == "niall");
+  result<void> j(success());
+  BOOST_REQUIRE(binary_encode(buffer, sizeof(buffer), j).value() == 5);
+  result<void> k(std::errc::invalid_argument);
+  BOOST_CHECK(binary_decode(buffer, 5, k).value() == 5);
+  BOOST_CHECK(k.has_value());
+
+  // Outcomes with serialisable exception types
+  outcome<int, std::error_code, long> l(failure(make_error_code(std::errc::invalid_argument), 78L));
+  BOOST_REQUIRE(binary_encode(buffer, sizeof(buffer), l).value() == 13 + sizeof(long));
+  outcome<int, std::error_code, long> m(success(5));
+  BOOST_CHECK(binary_decode(buffer, sizeof(buffer), m).value() == 13 + sizeof(long));
+  BOOST_CHECK(m.has_error() && m.has_exception());
+  BOOST_CHECK(m.error() == std::errc::invalid_argument);
+  BOOST_CHECK(m.exception() == 78);
+
+  // Bad input leaves the destination unchanged
+  BOOST_CHECK(binary_encode(buffer, 13, h).error() == std::errc::no_buffer_space);
+  BOOST_REQUIRE(binary_encode(buffer, sizeof(buffer), h).has_value());
+  BOOST_CHECK(binary_decode(buffer, 13, i).error() == std::errc::illegal_byte_sequence);
+  buffer[0] = binary_format_version + 1;
+  BOOST_CHECK(binary_decode(buffer, 14, i).error() == std::errc::protocol_not_supported);
+  BOOST_CHECK(i.value() == "niall");
+
+  // As does a status the destination could not have
+  auto decode_status = [&](uint32_t status, auto &v) {
+    const unsigned char bytes[] = {binary_format_version, static_cast<unsigned char>(status), 0, 0, 0};
+    return binary_decode(bytes, sizeof(bytes), v);
+  };
+  result<void> n(success());
+  outcome<void, void, void> o(success());
+  BOOST_CHECK(decode_status(0, n).error() == std::errc::illegal_byte_sequence);       // neither value nor error
+  BOOST_CHECK(decode_status(1 | 2, n).error() == std::errc::illegal_byte_sequence);   // both value and error
+  BOOST_CHECK(decode_status(4, n).error() == std::errc::illegal_byte_sequence);       // exception in a result
+  BOOST_CHECK(decode_status(1 | 16, n).error() == std::errc::illegal_byte_sequence);  // errno without an error
+  BOOST_CHECK(decode_status(1 | 32, n).error() == std::errc::illegal_byte_sequence);  // unknown bit
+  BOOST_CHECK(decode_status(1 | 4, o).error() == std::errc::illegal_byte_sequence);   // both value and exception
+  BOOST_CHECK(n.has_value() && o.has_value());
+  BOOST_CHECK(decode_status(2 | 4, o).value() == 5);
+  BOOST_CHECK(o.has_error() && o.has_exception() && !o.has_value());
+}
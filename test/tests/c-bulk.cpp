@@ -0,0 +1,78 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/experimental/result.h"
+#include "../../include/outcome/result.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <algorithm>
+#include <vector>
+
+CXX_DECLARE_RESULT_EC(int, int);
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / c_bulk, "Tests that the C bulk helpers work on arrays of C++ results as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static_assert(sizeof(CXX_RESULT_EC(int)) == sizeof(result<int>), "C result struct does not have the layout of result<int>");
+
+  struct custom_category : std::error_category
+  {
+    const char *name() const noexcept override { return "custom"; }
+    std::string message(int /*unused*/) const override { return "custom"; }
+  } custom;
+  for(size_t count : {0, 1, 15, 16, 17, 1000})
+  {
+    for(size_t failure : {count, count / 2, count - 1})
+    {
+      if(failure > count)
+      {
+        continue;
+      }
+      std::vector<result<int>> results(count, result<int>(success(5)));
+      if(failure < count)
+      {
+        results[failure] = std::errc::no_buffer_space;
+        for(size_t n = failure + 1; n < count; n += 3)
+        {
+          results[n] = std::error_code(78, custom);
+        }
+      }
+      const size_t failures = std::count_if(results.begin(), results.end(), [](const result<int> &r) { return r.has_error(); });
+      const auto *c = reinterpret_cast<const CXX_RESULT_EC(int) *>(results.data());  // NOLINT
+
+      BOOST_CHECK(CXX_RESULTS_COUNT_FAILURES(c, count) == failures);
+      BOOST_CHECK(CXX_RESULTS_FIND_FAILURE(c, count) == failure);
+
+      std::vector<int> errnos(count, -1);
+      BOOST_CHECK(CXX_RESULTS_EXTRACT_ERRNOS(errnos.data(), c, count) == failures);
+      for(size_t n = 0; n < count; n++)
+      {
+        BOOST_CHECK(errnos[n] == (results[n] ? 0 : (results[n].error().category() == custom ? EAGAIN : results[n].error().value())));
+      }
+
+      errno = -1;
+      BOOST_CHECK(CXX_RESULTS_SET_ERRNO(c, count) == failure);
+      BOOST_CHECK(errno == (failure < count ? ENOBUFS : 0));
+    }
+  }
+}
@@ -0,0 +1,77 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+// Must come first, so nothing else can have included the headers checked for below
+#include "../../include/outcome/basic_result.hpp"
+
+// basic_result with user defined types must not bring in the heavy standard library headers
+#if defined(_GLIBCXX_SYSTEM_ERROR) || defined(_LIBCPP_SYSTEM_ERROR) || defined(_SYSTEM_ERROR_)
+#error basic_result.hpp included <system_error>
+#endif
+#if defined(__EXCEPTION__) || defined(_LIBCPP_EXCEPTION) || defined(_EXCEPTION_)
+#error basic_result.hpp included <exception>
+#endif
+#if defined(_GLIBCXX_STRING) || defined(_LIBCPP_STRING) || defined(_STRING_)
+#error basic_result.hpp included <string>
+#endif
+#if defined(_GLIBCXX_IOSFWD) || defined(_LIBCPP_IOSFWD) || defined(_IOSFWD_)
+#error basic_result.hpp included <iosfwd>
+#endif
+// Without C++ exceptions, OUTCOME_THROW_EXCEPTION prints a backtrace and aborts instead
+#if defined(__cpp_exceptions) && (defined(_GLIBCXX_CSTDLIB) || defined(_LIBCPP_CSTDLIB) || defined(_CSTDLIB_))
+#error basic_result.hpp included <cstdlib>
+#endif
+
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+namespace core_header_set
+{
+  enum class error
+  {
+    none,
+    bad
+  };
+  using result = OUTCOME_V2_NAMESPACE::basic_result<int, error, OUTCOME_V2_NAMESPACE::policy::all_narrow>;
+
+  inline result parse(const char *s)
+  {
+    if(*s < '0' || *s > '9')
+    {
+      return OUTCOME_V2_NAMESPACE::failure(error::bad);
+    }
+    return OUTCOME_V2_NAMESPACE::success(*s - '0');
+  }
+}  // namespace core_header_set
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / core_header_set, "Tests that basic_result with user defined types needs only the core headers")
+{
+  using namespace core_header_set;
+  result a = parse("5"), b = parse("x");
+  BOOST_CHECK(a.has_value() && a.value() == 5);
+  BOOST_CHECK(b.has_error() && b.error() == error::bad);
+  swap(a, b);
+  BOOST_CHECK(a.error() == error::bad);
+  BOOST_CHECK(b == OUTCOME_V2_NAMESPACE::success(5));
+  result c(OUTCOME_V2_NAMESPACE::in_place_type<int>, 3);
+  BOOST_CHECK(c.value() == 3);
+}
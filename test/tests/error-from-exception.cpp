@@ -0,0 +1,136 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/utils.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <ios>
+#include <thread>
+#include <vector>
+
+#ifdef __cpp_exceptions
+namespace error_from_exception_test
+{
+  struct custom_error : std::runtime_error
+  {
+    custom_error()
+        : std::runtime_error("custom")
+    {
+    }
+  };
+  struct derived_custom_error : custom_error
+  {
+  };
+  // Virtual inheritance needs the thrown object to find the base
+  struct virtual_out_of_range : virtual std::out_of_range
+  {
+    virtual_out_of_range()
+        : std::out_of_range("virtual")
+    {
+    }
+  };
+  struct unrelated
+  {
+  };
+}  // namespace error_from_exception_test
+#endif
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / utils / error_from_exception, "Tests that error_from_exception maps exceptions to error codes")
+{
+#ifdef __cpp_exceptions
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace error_from_exception_test;
+  auto check = [](std::exception_ptr ep, std::error_code expected) {
+    std::error_code ec = error_from_exception(std::move(ep));
+    BOOST_CHECK(ec == expected);
+    BOOST_CHECK(!ep);
+  };
+  BOOST_CHECK(!error_from_exception(std::exception_ptr()));
+  check(std::make_exception_ptr(std::invalid_argument("")), std::make_error_code(std::errc::invalid_argument));
+  check(std::make_exception_ptr(std::domain_error("")), std::make_error_code(std::errc::argument_out_of_domain));
+  check(std::make_exception_ptr(std::length_error("")), std::make_error_code(std::errc::argument_list_too_long));
+  check(std::make_exception_ptr(std::out_of_range("")), std::make_error_code(std::errc::result_out_of_range));
+  check(std::make_exception_ptr(std::logic_error("")), std::make_error_code(std::errc::invalid_argument));
+  check(std::make_exception_ptr(std::system_error(std::make_error_code(std::errc::no_such_file_or_directory))), std::make_error_code(std::errc::no_such_file_or_directory));
+  check(std::make_exception_ptr(std::ios_base::failure("", std::make_error_code(std::errc::io_error))), std::make_error_code(std::errc::io_error));
+  check(std::make_exception_ptr(std::overflow_error("")), std::make_error_code(std::errc::value_too_large));
+  check(std::make_exception_ptr(std::range_error("")), std::make_error_code(std::errc::result_out_of_range));
+  check(std::make_exception_ptr(std::runtime_error("")), std::make_error_code(std::errc::resource_unavailable_try_again));
+  check(std::make_exception_ptr(std::bad_alloc()), std::make_error_code(std::errc::not_enough_memory));
+  check(std::make_exception_ptr(virtual_out_of_range()), std::make_error_code(std::errc::result_out_of_range));
+  // Exceptions obtained by throwing and catching, rather than make_exception_ptr()
+  try
+  {
+    throw std::system_error(std::make_error_code(std::errc::permission_denied));
+  }
+  catch(...)
+  {
+    BOOST_CHECK(error_from_exception() == std::make_error_code(std::errc::permission_denied));
+  }
+
+  // Unmatched exceptions return not_matched and leave the pointer alone
+  {
+    auto ep = std::make_exception_ptr(unrelated());
+    BOOST_CHECK(error_from_exception(std::move(ep), std::make_error_code(std::errc::bad_message)) == std::make_error_code(std::errc::bad_message));
+    BOOST_CHECK(ep);
+    BOOST_CHECK(error_from_exception(std::move(ep)) == std::make_error_code(std::errc::resource_unavailable_try_again));
+    BOOST_CHECK(ep);
+  }
+
+  // Registered mappings take precedence over the STL types, including for derived types
+  check(std::make_exception_ptr(custom_error()), std::make_error_code(std::errc::resource_unavailable_try_again));
+  register_error_from_exception<custom_error>(std::make_error_code(std::errc::operation_canceled));
+  check(std::make_exception_ptr(custom_error()), std::make_error_code(std::errc::operation_canceled));
+  check(std::make_exception_ptr(derived_custom_error()), std::make_error_code(std::errc::operation_canceled));
+  register_error_from_exception<derived_custom_error>(std::make_error_code(std::errc::timed_out));
+  check(std::make_exception_ptr(custom_error()), std::make_error_code(std::errc::operation_canceled));
+  check(std::make_exception_ptr(derived_custom_error()), std::make_error_code(std::errc::timed_out));
+  register_error_from_exception<unrelated>(std::make_error_code(std::errc::not_supported));
+  check(std::make_exception_ptr(unrelated()), std::make_error_code(std::errc::not_supported));
+  check(std::make_exception_ptr(std::runtime_error("")), std::make_error_code(std::errc::resource_unavailable_try_again));
+
+  // Concurrent conversion, with a registration racing them
+  {
+    std::vector<std::thread> threads;
+    std::atomic<int> failures{0};
+    for(int n = 0; n < 4; n++)
+    {
+      threads.emplace_back([&] {
+        for(int i = 0; i < 1000; i++)
+        {
+          if(error_from_exception(std::make_exception_ptr(std::out_of_range(""))) != std::make_error_code(std::errc::result_out_of_range) || error_from_exception(std::make_exception_ptr(derived_custom_error())) != std::make_error_code(std::errc::timed_out))
+          {
+            ++failures;
+          }
+        }
+      });
+    }
+    register_error_from_exception<std::domain_error>(std::make_error_code(std::errc::argument_out_of_domain));
+    for(auto &t : threads)
+    {
+      t.join();
+    }
+    BOOST_CHECK(failures == 0);
+  }
+#endif
+}
@@ -0,0 +1,67 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/utils.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / utils / error_message, "Tests that error messages are interned")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  const std::error_code a = make_error_code(std::errc::invalid_argument);
+  const std::error_code b(EINVAL, std::system_category());
+  const error_message_view ma = error_message(a);
+  BOOST_CHECK(std::string(ma.data(), ma.size()) == a.message());
+  BOOST_CHECK(ma.data()[ma.size()] == 0);
+  // The same code always gives the same string, and other categories theirs
+  BOOST_CHECK(error_message(a).data() == ma.data());
+  BOOST_CHECK(error_message(std::error_code(a)).data() == ma.data());
+  const error_message_view mb = error_message(b);
+  BOOST_CHECK(mb.data() != ma.data());
+  BOOST_CHECK(std::string(mb.data(), mb.size()) == b.message());
+
+  // Many threads asking for many codes at once all see a single interned message per code
+  std::vector<std::thread> threads;
+  std::vector<std::vector<const char *>> seen(4);
+  for(size_t n = 0; n < seen.size(); n++)
+  {
+    threads.emplace_back([&seen, n] {
+      for(int v = 1; v < 200; v++)
+      {
+        seen[n].push_back(error_message(std::error_code(v, std::generic_category())).data());
+      }
+    });
+  }
+  for(auto &t : threads)
+  {
+    t.join();
+  }
+  for(size_t n = 1; n < seen.size(); n++)
+  {
+    BOOST_CHECK(seen[n] == seen[0]);
+  }
+  BOOST_CHECK(seen[0][EINVAL - 1] == ma.data());
+}
@@ -215,3 +215,49 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / outcome, "Tests that the outc
     BOOST_CHECK(h.has_value());
   }
 }
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / outcome / failure, "Tests that failure() of an outcome with status_code makes the same exception as throwing")
+{
+#ifdef __cpp_exceptions
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  using OUTCOME_V2_NAMESPACE::experimental::status_outcome;
+  auto check = [](std::exception_ptr made, std::exception_ptr thrown) {
+    BOOST_REQUIRE(made);
+    BOOST_REQUIRE(thrown);
+    try
+    {
+      std::rethrow_exception(made);
+    }
+    catch(const status_error<void> &e)
+    {
+      try
+      {
+        std::rethrow_exception(thrown);
+      }
+      catch(const status_error<void> &f)
+      {
+        BOOST_CHECK(typeid(e) == typeid(f));
+        BOOST_CHECK(std::string(e.what()) == f.what());
+      }
+    }
+  };
+  using OUTCOME_V2_NAMESPACE::detail::adl::status_code_exception_ptr_by_throw;
+  {  // typed generic
+    status_outcome<int> m(generic_code{errc::bad_address});
+    check(m.failure(), status_code_exception_ptr_by_throw(m.error()));
+    BOOST_CHECK_THROW(std::rethrow_exception(m.failure()), generic_error);
+  }
+  {  // typed posix
+    status_outcome<int, _posix_code_domain> m(posix_code{EACCES});
+    check(m.failure(), status_code_exception_ptr_by_throw(m.error()));
+    BOOST_CHECK_THROW(std::rethrow_exception(m.failure()), posix_error);
+  }
+  {  // erased generic and posix
+    outcome<int> m(generic_code{errc::bad_address});
+    check(m.failure(), status_code_exception_ptr_by_throw(m.error()));
+    outcome<int> n(posix_code{EACCES});
+    check(n.failure(), status_code_exception_ptr_by_throw(n.error()));
+    BOOST_CHECK_THROW(std::rethrow_exception(n.failure()), posix_error);
+  }
+#endif
+}
@@ -0,0 +1,76 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+// Also built linking outcome::sl, which defines OUTCOME_USE_EXTERN_TEMPLATES
+#include "../../include/outcome.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <string>
+#include <type_traits>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / extern_templates, "Tests that the explicitly instantiated results and outcomes work as usual")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  // Explicit instantiation changes no property of the types
+  static_assert(std::is_trivially_copyable<result<int>>::value, "result<int> is no longer trivially copyable");
+  static_assert(std::is_nothrow_move_constructible<outcome<std::string>>::value, "outcome<std::string> is no longer nothrow movable");
+
+  result<void> a(success()), b(std::errc::invalid_argument);
+  BOOST_CHECK(a.has_value());
+  BOOST_CHECK(b.error() == std::errc::invalid_argument);
+  a.swap(b);
+  BOOST_CHECK(a.has_error() && b.has_value());
+
+  result<int> c(5), d(c), e(std::errc::not_enough_memory);
+  BOOST_CHECK(d.value() == 5);
+  BOOST_CHECK(c == d);
+  BOOST_CHECK(c != e);
+  d = e;
+  BOOST_CHECK(d.error() == std::errc::not_enough_memory);
+#ifdef __cpp_exceptions
+  BOOST_CHECK_THROW(d.value(), std::system_error);
+#endif
+
+  result<std::string> f("niall"), g(std::move(f));
+  BOOST_CHECK(g.value() == "niall");
+  BOOST_CHECK(g == success("niall"));
+
+  outcome<void> h(success()), i(std::errc::invalid_argument);
+  BOOST_CHECK(h.has_value() && i.has_error());
+  outcome<int> j(c), k(e);
+  BOOST_CHECK(j.value() == 5);
+  BOOST_CHECK(k.error() == std::errc::not_enough_memory);
+  outcome<std::string> l(g), m(std::errc::invalid_argument);
+  BOOST_CHECK(l.value() == "niall");
+  BOOST_CHECK(m.error() == std::errc::invalid_argument);
+#ifdef __cpp_exceptions
+  BOOST_CHECK(k.failure() != nullptr);
+  outcome<std::string> n(std::make_exception_ptr(std::runtime_error("douglas")));
+  BOOST_CHECK(n.has_exception());
+  BOOST_CHECK_THROW(n.value(), std::runtime_error);
+#endif
+
+  // Types not in the list still instantiate implicitly
+  result<double> o(1.5);
+  BOOST_CHECK(o.value() == 1.5);
+}
@@ -0,0 +1,73 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/format_support.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <iterator>
+
+namespace format_support_test
+{
+  template <class Impl> inline std::string format(const Impl &v)
+  {
+    char buffer[256];
+    auto r = OUTCOME_V2_NAMESPACE::to_chars(buffer, buffer + sizeof(buffer), v);
+    BOOST_CHECK(r.ec == std::errc());
+    BOOST_CHECK(static_cast<size_t>(r.ptr - buffer) == OUTCOME_V2_NAMESPACE::formatted_size(v));
+    return std::string(buffer, r.ptr);
+  }
+}  // namespace format_support_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / format_support, "Tests that result and outcome format into caller buffers as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using format_support_test::format;
+  const std::error_code ec = make_error_code(std::errc::invalid_argument);
+  const std::string ec_text = std::string(std::generic_category().name()) + ":" + std::to_string(EINVAL);
+
+  BOOST_CHECK(format(result<int>(-78)) == "-78");
+  BOOST_CHECK(format(result<int>(ec)) == ec_text);
+  BOOST_CHECK(format(result<unsigned long long>(18446744073709551615ULL)) == "18446744073709551615");
+  BOOST_CHECK(format(result<double>(1.5)) == "1.5");
+  BOOST_CHECK(format(result<bool>(true)) == "true");
+  BOOST_CHECK(format(result<std::string>("niall")) == "niall");
+  BOOST_CHECK(format(result<const char *>("niall")) == "niall");
+  BOOST_CHECK(format(result<void>(success())) == "(+void)");
+  BOOST_CHECK(format(result<int, void>(5)) == "5");
+  BOOST_CHECK(format(outcome<int>(5)) == "5");
+  BOOST_CHECK(format(outcome<int>(std::make_exception_ptr(5))) == "(exception)");
+  BOOST_CHECK(format(outcome<int>(ec, std::make_exception_ptr(5))) == "{ " + ec_text + ", (exception) }");
+  BOOST_CHECK(format(outcome<int, std::error_code, long>(failure(ec, 6L))) == "{ " + ec_text + ", 6 }");
+
+  // Output iterators
+  std::string s;
+  format_to(std::back_inserter(s), result<int>(5));
+  BOOST_CHECK(s == "5");
+
+  // Too small a buffer keeps what fits
+  char buffer[4];
+  auto r = to_chars(buffer, buffer + sizeof(buffer), result<std::string>("niall"));
+  BOOST_CHECK(r.ec == std::errc::value_too_large);
+  BOOST_CHECK(r.ptr == buffer + 4);
+  BOOST_CHECK(std::string(buffer, r.ptr) == "nial");
+}
@@ -0,0 +1,139 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/iostream_support.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / from_chars, "Tests that results and outcomes parse from text as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  auto roundtrip = [](const auto &a, auto &b) {
+    std::stringstream ss;
+    ss << a;
+    const std::string s = ss.str();
+    auto r = from_chars(s.data(), s.data() + s.size(), b);
+    BOOST_REQUIRE(r);
+    BOOST_CHECK(r.value() == s.data() + s.size());
+  };
+  {
+    result<int> a(5), b(6), c(std::error_code(5, std::generic_category())), d(7);
+    roundtrip(a, b);
+    BOOST_CHECK(b.value() == 5);
+    roundtrip(c, d);
+    BOOST_CHECK(d.error() == std::error_code(5, std::generic_category()));
+  }
+  {
+    result<double, std::string> a(1.5), b("x"), c("failed"), d(0.0);
+    roundtrip(a, b);
+    BOOST_CHECK(b.value() == 1.5);
+    roundtrip(c, d);
+    BOOST_CHECK(d.error() == "failed");
+  }
+  {
+    result<void> a(std::error_code(1, std::system_category()));
+    const char s[] = "1 ";
+    auto r = from_chars(s, s + 2, a);
+    BOOST_REQUIRE(r);
+    BOOST_CHECK(r.value() == s + 2);
+    BOOST_CHECK(a.has_value());
+  }
+  {
+    outcome<int, std::string, long> a(in_place_type<long>, 78L), b(in_place_type<std::string>, "oops"), c(success(5));
+    roundtrip(a, c);
+    BOOST_CHECK(c.exception() == 78);
+    roundtrip(b, c);
+    BOOST_CHECK(c.error() == "oops");
+    BOOST_CHECK(!c.has_exception());
+  }
+  // Invalid text leaves the destination untouched
+  {
+    result<int> a(5);
+    const char *bad[] = {"", "1", "x 5", "1 x", "2 nosuchcategory:5", "1 99999999999999999999",
+                         // Statuses a result cannot have
+                         "0 ", "3 5 generic:22", "4 9", "17 5", "33 5"};
+    for(const char *s : bad)
+    {
+      auto r = from_chars(s, s + strlen(s), a);
+      BOOST_CHECK(!r);
+      BOOST_CHECK(r.error() == std::errc::invalid_argument);
+      BOOST_CHECK(a.value() == 5);
+    }
+  }
+  {
+    outcome<int, std::string, long> a(success(5));
+    const char *bad[] = {"0 ", "5 1 2", "7 1 x 2"};
+    for(const char *s : bad)
+    {
+      auto r = from_chars(s, s + strlen(s), a);
+      BOOST_CHECK(!r);
+      BOOST_CHECK(r.error() == std::errc::invalid_argument);
+      BOOST_CHECK(a.value() == 5);
+    }
+    const char good[] = "6 x 2";
+    BOOST_REQUIRE(from_chars(good, good + strlen(good), a));
+    BOOST_CHECK(a.has_error() && a.has_exception() && a.exception() == 2);
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / from_chars_lines, "Tests that newline separated results parse from text as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using parsed_result = unchecked<int, long>;
+  std::stringstream ss;
+  for(int n = 0; n < 10; n++)
+  {
+    if(n % 3 == 0)
+    {
+      ss << parsed_result(failure(static_cast<long>(n))) << "\n";
+    }
+    else
+    {
+      ss << parsed_result(success(n)) << "\r\n\n";
+    }
+  }
+  const std::string s = ss.str();
+  std::vector<parsed_result> parsed;
+  parsed_result v(success(0));
+  auto r = from_chars_lines(s.data(), s.data() + s.size(), v, [&](const parsed_result &i) { parsed.push_back(i); });
+  BOOST_REQUIRE(r);
+  BOOST_CHECK(r.value() == 10);
+  BOOST_REQUIRE(parsed.size() == 10);
+  for(int n = 0; n < 10; n++)
+  {
+    BOOST_CHECK(parsed[n].has_error() == (n % 3 == 0));
+    BOOST_CHECK(parsed[n].has_error() ? parsed[n].error() == n : parsed[n].value() == n);
+  }
+
+  // Parsing stops at the first invalid record
+  const std::string bad = "1 1\n1 2 junk\n1 3\n";
+  size_t count = 0;
+  r = from_chars_lines(bad.data(), bad.data() + bad.size(), v, [&](const parsed_result & /*unused*/) { ++count; });
+  BOOST_CHECK(!r);
+  BOOST_CHECK(count == 1);
+#if __cplusplus >= 201700
+  r = from_chars_lines(std::string_view(s), v, [](const parsed_result & /*unused*/) {});
+  BOOST_CHECK(r && r.value() == 10);
+#endif
+}
@@ -27,6 +27,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include "quickcpplib/include/boost/test/unit_test.hpp"
 
 #include <iostream>
+#include <memory>
 
 namespace hook_test
 {
@@ -105,3 +106,106 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / hooks, "Tests that you can hook o
   outcome<int> e(OUTCOME_V2_NAMESPACE::result<int>(5));
   BOOST_CHECK(!e.has_exception());
 }
+
+namespace destruction_hook_test
+{
+  static int destroyed, states_observed, values_observed, errors_observed;
+
+  // Use a local error_code type as the ADL bridge for the destruction and observation hooks
+  struct error_code : public std::error_code
+  {
+    using std::error_code::error_code;
+    error_code() = default;
+    error_code(std::error_code ec)  // NOLINT
+    : std::error_code(ec)
+    {
+    }
+  };
+  template <class R> using result = OUTCOME_V2_NAMESPACE::result<R, error_code>;
+  template <class R, class S, class P> using result_or_outcome = OUTCOME_V2_NAMESPACE::detail::basic_result_final<R, S, P>;
+
+  template <class T, class P> inline void hook_result_destruction(result_or_outcome<T, error_code, P> * /*unused*/) noexcept { ++destroyed; }
+  template <class T, class P> constexpr inline void hook_result_state_observation(const result_or_outcome<T, error_code, P> * /*unused*/) noexcept { ++states_observed; }
+  template <class T, class P> constexpr inline void hook_result_value_observation(const result_or_outcome<T, error_code, P> * /*unused*/) noexcept { ++values_observed; }
+  template <class T, class P> constexpr inline void hook_result_error_observation(const result_or_outcome<T, error_code, P> *r) noexcept
+  {
+    ++errors_observed;
+    OUTCOME_V2_NAMESPACE::hooks::mark_as_observed(r);
+  }
+}  // namespace destruction_hook_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / destruction_hooks, "Tests that you can hook result's destruction and observation")
+{
+  using namespace destruction_hook_test;
+  // Customising the destruction hook adds a destructor, not customising it does not
+  static_assert(!std::is_trivially_destructible<result<int>>::value, "result<int> with destruction hook is trivially destructible!");
+  static_assert(std::is_trivially_destructible<OUTCOME_V2_NAMESPACE::result<int>>::value, "result<int> is not trivially destructible!");
+  // Move only types must stay move only
+  static_assert(std::is_move_constructible<result<std::unique_ptr<int>>>::value, "result<unique_ptr> with destruction hook is not move constructible!");
+  static_assert(!std::is_copy_constructible<result<std::unique_ptr<int>>>::value, "result<unique_ptr> with destruction hook is copy constructible!");
+  {
+    result<int> a(5);
+    BOOST_CHECK(a.has_value());
+    BOOST_CHECK(a.value() == 5);
+    BOOST_CHECK(states_observed == 1);
+    BOOST_CHECK(values_observed == 1);
+    result<int> b(error_code(std::make_error_code(std::errc::invalid_argument)));
+    BOOST_CHECK(OUTCOME_V2_NAMESPACE::hooks::has_unobserved_failure(&b));
+    BOOST_CHECK(b.error() == std::errc::invalid_argument);
+    BOOST_CHECK(errors_observed == 1);
+    BOOST_CHECK(!OUTCOME_V2_NAMESPACE::hooks::has_unobserved_failure(&b));
+    BOOST_CHECK(destroyed == 0);
+  }
+  BOOST_CHECK(destroyed == 2);
+  {
+    result<std::unique_ptr<int>> a(std::make_unique<int>(5));
+    result<std::unique_ptr<int>> b(std::move(a));
+    BOOST_CHECK(*b.value() == 5);
+  }
+  BOOST_CHECK(destroyed == 4);
+}
+
+namespace spare_storage_test
+{
+  namespace hooks = OUTCOME_V2_NAMESPACE::hooks;
+  enum class origin : uint8_t
+  {
+    unknown,
+    network,
+    disc
+  };
+  // Three independent consumers of the spare storage
+  using tracing = hooks::spare_storage_registry<>::allocate<4>;
+  using registry1 = hooks::spare_storage_registry<tracing>;
+  using sampled = registry1::allocate<1, bool>;
+  using registry2 = registry1::add<sampled>;
+  using where = registry2::allocate<2, origin>;
+  using registry3 = registry2::add<where>;
+  static_assert(tracing::offset == 0 && sampled::offset == 4 && where::offset == 5, "Spare storage fields were not allocated contiguously");
+  static_assert(registry3::used == 0x7f && registry3::available == 0xff80, "Spare storage registry is not tracking used bits");
+}  // namespace spare_storage_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / spare_storage, "Tests that the spare storage can be partitioned")
+{
+  using namespace spare_storage_test;
+  OUTCOME_V2_NAMESPACE::result<int> a(5);
+  hooks::set_spare_storage(&a, 0xffff);
+  hooks::set_spare_storage(&a, 0x1234);
+  BOOST_CHECK(hooks::spare_storage(&a) == 0x1234);
+  BOOST_CHECK(a.value() == 5);
+  hooks::set_spare_storage(&a, 0);
+  hooks::set_spare_storage<tracing>(&a, 9);
+  hooks::set_spare_storage<sampled>(&a, true);
+  hooks::set_spare_storage<where>(&a, origin::disc);
+  BOOST_CHECK(hooks::spare_storage<tracing>(&a) == 9);
+  BOOST_CHECK(hooks::spare_storage<sampled>(&a));
+  BOOST_CHECK(hooks::spare_storage<where>(&a) == origin::disc);
+  // Setting clears the previous value of the field only, and discards bits which do not fit
+  hooks::set_spare_storage<tracing>(&a, 0x16);
+  hooks::set_spare_storage<where>(&a, origin::network);
+  BOOST_CHECK(hooks::spare_storage<tracing>(&a) == 6);
+  BOOST_CHECK(hooks::spare_storage<sampled>(&a));
+  BOOST_CHECK(hooks::spare_storage<where>(&a) == origin::network);
+  BOOST_CHECK(hooks::spare_storage(&a) == 0x36);
+  BOOST_CHECK(a.has_value() && a.value() == 5);
+}
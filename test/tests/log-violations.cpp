@@ -0,0 +1,137 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/outcome.hpp"
+#include "../../include/outcome/policy/log_violations.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <cstring>
+#include <string>
+
+#if defined(OUTCOME_RETURN_ADDRESS) || defined(OUTCOME_FUNCTION_SIGNATURE)
+#error log_violations.hpp must not leak its helper macros
+#endif
+
+namespace log_violations_test
+{
+  struct counting_handler : OUTCOME_V2_NAMESPACE::policy::default_violation_handler
+  {
+    static int &calls()
+    {
+      static int v;
+      return v;
+    }
+    static void on_violation(const OUTCOME_V2_NAMESPACE::policy::wide_violation & /*unused*/) noexcept { ++calls(); }
+    template <class T> static T fallback() { return T(); }
+  };
+  template <> inline int counting_handler::fallback<int>() { return -1; }
+  template <> inline std::string counting_handler::fallback<std::string>() { return "fallback"; }
+
+  template <class T> using logged_result = OUTCOME_V2_NAMESPACE::result<T, std::error_code, OUTCOME_V2_NAMESPACE::policy::log_violations<counting_handler>>;
+  template <class T> using logged_outcome = OUTCOME_V2_NAMESPACE::outcome<T, std::error_code, std::exception_ptr, OUTCOME_V2_NAMESPACE::policy::log_violations<counting_handler>>;
+}  // namespace log_violations_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / policy / log_violations, "Tests that the violation logging policy logs and carries on")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace log_violations_test;
+  auto &violations = policy::wide_violations();
+  const size_t before = violations.count();
+  counting_handler::calls() = 0;
+
+  // Correct wide accesses are never logged
+  logged_result<int> good(5);
+  BOOST_CHECK(good.value() == 5);
+  BOOST_CHECK(violations.count() == before);
+
+  // A missing value is logged, and the fallback value returned
+  logged_result<int> a(std::errc::invalid_argument);
+  BOOST_CHECK(a.value() == -1);
+  BOOST_CHECK(violations.count() == before + 1);
+  BOOST_CHECK(counting_handler::calls() == 1);
+  policy::wide_violation v;
+  BOOST_REQUIRE(violations.get(before, v));
+  BOOST_CHECK(v.object == &a);
+  BOOST_CHECK(v.check == policy::wide_check::value);
+  BOOST_CHECK((v.status & 2U) != 0);  // had error
+  BOOST_REQUIRE(v.type != nullptr);
+  BOOST_CHECK(strstr(v.type, "basic_result") != nullptr);
+  BOOST_CHECK(v.return_address != nullptr);
+  // The object now has the fallback value, and is not logged again
+  BOOST_CHECK(a.has_value());
+  BOOST_CHECK(!a.has_error());
+  BOOST_CHECK(!a.has_failure());
+  BOOST_CHECK(a.value() == -1);
+  BOOST_CHECK(violations.count() == before + 1);
+
+  // Non-trivial fallbacks are constructed in place, and destroyed with the object
+  {
+    logged_result<std::string> b(std::errc::invalid_argument);
+    BOOST_CHECK(b.value() == "fallback");
+    BOOST_CHECK(violations.count() == before + 2);
+  }
+
+  // Missing errors and exceptions are logged, and return the default constructed one
+  BOOST_CHECK(!good.error());
+  BOOST_CHECK(violations.count() == before + 3);
+  BOOST_REQUIRE(violations.get(before + 2, v));
+  BOOST_CHECK(v.check == policy::wide_check::error);
+  logged_outcome<int> c(5);
+  BOOST_CHECK(!c.exception());
+  BOOST_CHECK(violations.count() == before + 4);
+  BOOST_REQUIRE(violations.get(before + 3, v));
+  BOOST_CHECK(v.check == policy::wide_check::exception);
+  BOOST_CHECK(counting_handler::calls() == 4);
+
+  // Outcomes lose their exception when given the fallback value
+  logged_outcome<int> e(std::make_exception_ptr(5));
+  BOOST_CHECK(e.value() == -1);
+  BOOST_CHECK(e.has_value());
+  BOOST_CHECK(!e.has_exception());
+  BOOST_CHECK(!e.has_failure());
+  BOOST_CHECK(violations.count() == before + 5);
+
+  // void values need no fallback, so may be const
+  const logged_result<void> d(std::errc::invalid_argument);
+  d.value();
+  BOOST_CHECK(violations.count() == before + 6);
+  BOOST_CHECK(d.has_error());
+
+  // Const objects cannot be given the fallback, so keep their failure and return a shared fallback
+  const logged_result<int> f(std::errc::invalid_argument);
+  BOOST_CHECK(f.value() == -1);
+  BOOST_CHECK(f.has_error());
+  BOOST_CHECK(violations.count() == before + 7);
+  BOOST_CHECK(std::move(f).value() == -1);
+  BOOST_CHECK(violations.count() == before + 8);
+  logged_outcome<std::string> g(std::make_exception_ptr(5));
+  const auto &h = g;
+  BOOST_CHECK(h.value() == "fallback");
+  BOOST_CHECK(g.has_exception());
+  BOOST_CHECK(&h.value() == &h.value());
+  BOOST_CHECK(violations.count() == before + 11);
+  const logged_result<int> i(5);
+  BOOST_CHECK(i.value() == 5);
+  BOOST_CHECK(violations.count() == before + 11);
+  BOOST_CHECK(counting_handler::calls() == 11);
+}
@@ -0,0 +1,160 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/outcome.hpp"
+#include "../../include/outcome/policy/sampled_narrow.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / policy / sampled_narrow, "Tests that the sampled narrow policy reports one in N violating narrow accesses")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using sampled_result = result<int, std::error_code, policy::sampled_narrow<policy::error_code_throw_as_system_error<int, std::error_code, void>, 4>>;
+  using sampled_outcome = outcome<int, std::error_code, std::exception_ptr, policy::sampled_narrow<policy::error_code_throw_as_system_error<int, std::error_code, std::exception_ptr>, 4>>;
+  auto &violations = policy::narrow_violations();
+  const size_t before = violations.count();
+
+  // Correct narrow accesses are never reported
+  sampled_result good(5);
+  for(int n = 0; n < 100; n++)
+  {
+    BOOST_CHECK(good.assume_value() == 5);
+  }
+  BOOST_CHECK(violations.count() == before);
+
+  // The countdown is shared by all sampled accesses of a type on this thread, so 16 accesses sample exactly 4
+  sampled_result bad(std::errc::invalid_argument);
+  for(int n = 0; n < 16; n++)
+  {
+    (void) bad.assume_value();
+  }
+  BOOST_CHECK(violations.count() == before + 4);
+  policy::narrow_violation v;
+  BOOST_REQUIRE(violations.get(before, v));
+  BOOST_CHECK(v.object == &bad);
+  BOOST_CHECK(v.check == policy::narrow_check::value);
+  BOOST_CHECK((v.status & 2U) != 0);  // has error
+
+  // Error and exception observers are sampled too
+  sampled_outcome o(5);
+  for(int n = 0; n < 4; n++)
+  {
+    (void) o.assume_error();
+  }
+  BOOST_CHECK(violations.count() == before + 5);
+  BOOST_REQUIRE(violations.get(before + 4, v));
+  BOOST_CHECK(v.check == policy::narrow_check::error);
+  for(int n = 0; n < 4; n++)
+  {
+    (void) o.assume_exception();
+  }
+  BOOST_CHECK(violations.count() == before + 6);
+  BOOST_REQUIRE(violations.get(before + 5, v));
+  BOOST_CHECK(v.check == policy::narrow_check::exception);
+
+  // Wide checks are still those of the wrapped policy
+#ifdef __cpp_exceptions
+  BOOST_CHECK_THROW(bad.value(), std::system_error);
+#endif
+
+  // Each thread has its own countdown, and the buffer keeps only the most recent violations
+  {
+    std::thread t([&] {
+      for(size_t n = 0; n < 4 * policy::narrow_violation_buffer::capacity() * 2; n++)
+      {
+        (void) bad.assume_value();
+      }
+    });
+    t.join();
+  }
+  BOOST_CHECK(violations.count() == before + 6 + policy::narrow_violation_buffer::capacity() * 2);
+  BOOST_CHECK(!violations.get(before, v));
+  BOOST_CHECK(violations.get(violations.count() - 1, v));
+
+  // Types with different intervals each keep their own rate when mixed on one thread
+  {
+    using every_result = result<int, std::error_code, policy::sampled_narrow<policy::error_code_throw_as_system_error<int, std::error_code, void>, 1>>;
+    using rare_result = result<int, std::error_code, policy::sampled_narrow<policy::error_code_throw_as_system_error<int, std::error_code, void>, 1000>>;
+    every_result every(std::errc::invalid_argument);
+    rare_result rare(std::errc::invalid_argument);
+    const size_t mixed = violations.count();
+    for(int n = 0; n < 2000; n++)
+    {
+      (void) every.assume_value();
+      (void) rare.assume_value();
+    }
+    BOOST_CHECK(violations.count() == mixed + 2000 + 2);
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / policy / violation_ring, "Tests that the violation ring never returns a torn entry when writers lap it")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  // Every word of an entry is the same, so a torn entry has differing words
+  struct entry
+  {
+    uintptr_t words[4];
+  };
+  static detail::violation_ring<entry, 2> ring;
+  std::atomic<bool> done{false};
+  size_t read = 0, torn = 0;
+  std::thread reader([&] {
+    while(!done.load(std::memory_order_relaxed))
+    {
+      const size_t count = ring.count();
+      for(size_t n = (count > 2) ? count - 2 : 0; n < count; n++)
+      {
+        entry e;
+        if(ring.get(n, e))
+        {
+          ++read;
+          torn += static_cast<size_t>(e.words[0] != e.words[1] || e.words[0] != e.words[2] || e.words[0] != e.words[3]);
+        }
+      }
+    }
+  });
+  std::vector<std::thread> writers;
+  for(uintptr_t t = 0; t < 4; t++)
+  {
+    writers.emplace_back([&, t] {
+      for(uintptr_t n = 0; n < 100000; n++)
+      {
+        const uintptr_t v = (t << 24U) | n;
+        ring.report(entry{{v, v, v, v}});
+      }
+    });
+  }
+  for(auto &t : writers)
+  {
+    t.join();
+  }
+  done = true;
+  reader.join();
+  BOOST_CHECK(ring.count() == 400000);
+  BOOST_CHECK(torn == 0);
+  std::cout << "Read " << read << " entries while writers lapped the ring, of which " << torn << " were torn" << std::endl;
+}
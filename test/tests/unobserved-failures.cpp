@@ -0,0 +1,140 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#define OUTCOME_ENABLE_UNOBSERVED_ERROR_COUNTING
+#include "../../include/outcome/outcome.hpp"
+#include "../../include/outcome/try.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+namespace unobserved_failures
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  inline result<int> fail() { return std::errc::invalid_argument; }
+  inline result<int> propagate()
+  {
+    OUTCOME_TRY(v, fail());
+    return v;
+  }
+}  // namespace unobserved_failures
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / unobserved_failures, "Tests that failed results destroyed without being observed are counted")
+{
+  using namespace unobserved_failures;
+  static_assert(!std::is_trivially_destructible<result<int>>::value, "result<int> is trivially destructible when counting unobserved failures!");
+  auto &count = hooks::unobserved_failures_destroyed();
+  count = 0;
+  {
+    // Successful results are never counted
+    result<int> a(5);
+    result<void> b(success());
+  }
+  BOOST_CHECK(count == 0);
+  {
+    // Dropped failures are counted
+    result<int> a(std::errc::invalid_argument);
+    result<void> b(std::errc::invalid_argument);
+    (void) fail();
+  }
+  BOOST_CHECK(count == 3);
+  count = 0;
+  {
+    // Any kind of inspection counts as observation
+    result<int> a(std::errc::invalid_argument);
+    BOOST_CHECK(!a);
+    result<int> b(std::errc::invalid_argument);
+    BOOST_CHECK(b.has_error());
+    result<int> c(std::errc::invalid_argument);
+    BOOST_CHECK(c.error() == std::errc::invalid_argument);
+    result<int> d(std::errc::invalid_argument);
+    BOOST_CHECK(d == failure(make_error_code(std::errc::invalid_argument)));
+    result<int> e(std::errc::invalid_argument);
+    BOOST_CHECK(e.as_failure().error() == std::errc::invalid_argument);
+  }
+  BOOST_CHECK(count == 0);
+  {
+    // Copying, moving and converting hands on the responsibility to observe
+    result<int> a(std::errc::invalid_argument);
+    result<int> b(a);
+    result<int> c(std::move(b));
+    result<long> d(c);
+    outcome<long> e(std::move(d));
+  }
+  BOOST_CHECK(count == 1);
+  count = 0;
+  {
+    // Assigning over an unobserved failure drops it, and hands on the responsibility to observe
+    result<int> a(std::errc::invalid_argument);
+    a = result<int>(5);
+    BOOST_CHECK(count == 1);
+    result<int> b(std::errc::invalid_argument);
+    result<int> c(std::errc::invalid_argument);
+    BOOST_CHECK(c.has_error());
+    b = c;
+    BOOST_CHECK(count == 2);
+    b = b;
+    BOOST_CHECK(count == 2);
+    result<int> d(std::errc::invalid_argument);
+    d = std::move(c);
+    BOOST_CHECK(count == 3);
+  }
+  BOOST_CHECK(count == 3);
+  count = 0;
+  {
+    // Observing const results works too
+    const result<int> a(std::errc::invalid_argument);
+    BOOST_CHECK(a.has_error());
+    const result<int> b(std::errc::invalid_argument);
+    result<int> c(b);
+  }
+  BOOST_CHECK(count == 1);
+  count = 0;
+  {
+    // Propagating a failure via TRY observes it, the returned failure is not observed
+    (void) propagate();
+    BOOST_CHECK(count == 1);
+    BOOST_CHECK(propagate().has_error());
+    BOOST_CHECK(count == 1);
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / unobserved_failures, "Tests that failed outcomes destroyed without being observed are counted")
+{
+  using namespace unobserved_failures;
+  auto &count = hooks::unobserved_failures_destroyed();
+  count = 0;
+  {
+    outcome<int> a(std::errc::invalid_argument);
+    outcome<int> b(std::errc::invalid_argument);
+    BOOST_CHECK(b.has_failure());
+  }
+  BOOST_CHECK(count == 1);
+  count = 0;
+#ifdef __cpp_exceptions
+  {
+    outcome<int> a(std::make_exception_ptr(std::runtime_error("hi")));
+    outcome<int> b(std::make_exception_ptr(std::runtime_error("hi")));
+    BOOST_CHECK(b.exception());
+  }
+  BOOST_CHECK(count == 1);
+#endif
+}